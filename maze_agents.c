@@ -0,0 +1,195 @@
+/*******************************************************************************************
+*
+*   maze_agents - Maze agents (chasers) steered by a shared flow field
+*
+*   Steering: every agent looks up its cell distance in the flow field and heads to the
+*   center of the first neighbor cell one step closer to the source (target position
+*   if already in source cell), velocity is smoothly turned towards that direction and
+*   box is moved with swept collision, so agents slide around corners, never into walls
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "maze_agents.h"
+#include "maze_collision.h"     // Required for: MoveMazeBox()
+#include "maze_jobs.h"          // Required for: RunMazeJobs()
+
+#include <stdlib.h>     // Required for: malloc(), free()
+#include <math.h>       // Required for: floorf(), sqrtf()
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Agents update data, shared by all jobs
+typedef struct MazeAgentsUpdate {
+    MazeAgents *agents;
+    MazeGrid grid;
+    float cellSize;
+    MazeDistanceField field;
+    Vector2 target;
+    float deltaTime;
+} MazeAgentsUpdate;
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Declaration
+//----------------------------------------------------------------------------------
+static void UpdateMazeAgentsJob(void *data, int job);      // Update one range of MAZE_AGENTS_JOB_SIZE agents (job)
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Load agents store, all arrays allocated at once (single memory block)
+MazeAgents LoadMazeAgents(int capacity, float size, float speed)
+{
+    MazeAgents agents = { 0 };
+
+    if (capacity <= 0) return agents;
+
+    // NOTE: Float arrays first, so all of them are aligned
+    size_t floatArray = (size_t)capacity*sizeof(float);
+    unsigned char *memory = (unsigned char *)malloc(7*floatArray + (size_t)capacity);
+
+    if (memory == NULL) return agents;
+
+    agents.capacity = capacity;
+    agents.size = size;
+    agents.speed = speed;
+    agents.positionX = (float *)memory;
+    agents.positionY = (float *)(memory + floatArray);
+    agents.previousX = (float *)(memory + 2*floatArray);
+    agents.previousY = (float *)(memory + 3*floatArray);
+    agents.velocityX = (float *)(memory + 4*floatArray);
+    agents.velocityY = (float *)(memory + 5*floatArray);
+    agents.frameTimes = (float *)(memory + 6*floatArray);
+    agents.frames = memory + 7*floatArray;
+
+    return agents;
+}
+
+// Unload agents store from memory (RAM)
+void UnloadMazeAgents(MazeAgents agents)
+{
+    free(agents.positionX);     // NOTE: First array is the start of the memory block
+}
+
+// Remove all agents, keeping memory
+void ClearMazeAgents(MazeAgents *agents)
+{
+    agents->count = 0;
+}
+
+// Add agent at position (box top-left), returns index, -1 if store is full
+int AddMazeAgent(MazeAgents *agents, Vector2 position, int frame)
+{
+    if (agents->count >= agents->capacity) return -1;
+
+    int index = agents->count++;
+
+    agents->positionX[index] = position.x;
+    agents->positionY[index] = position.y;
+    agents->previousX[index] = position.x;
+    agents->previousY[index] = position.y;
+    agents->velocityX[index] = 0.0f;
+    agents->velocityY[index] = 0.0f;
+    agents->frameTimes[index] = 0.0f;
+    agents->frames[index] = (unsigned char)(frame%MAZE_AGENT_FRAMES);
+
+    return index;
+}
+
+// Update agents, moving them towards field source (target in source cell) resolving collisions against walls
+void UpdateMazeAgents(MazeAgents *agents, MazeGrid grid, float cellSize, MazeDistanceField field, Vector2 target, float deltaTime, int threadCount)
+{
+    if ((agents->count == 0) || (field.distances == NULL) || (field.width != grid.width) || (field.height != grid.height)) return;
+
+    MazeAgentsUpdate update = { agents, grid, cellSize, field, target, deltaTime };
+    int jobCount = (agents->count + MAZE_AGENTS_JOB_SIZE - 1)/MAZE_AGENTS_JOB_SIZE;
+
+    RunMazeJobs(UpdateMazeAgentsJob, &update, jobCount, threadCount);
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+// Update one range of MAZE_AGENTS_JOB_SIZE agents (job)
+// NOTE: Only agents of the range are written, ranges can be processed concurrently
+static void UpdateMazeAgentsJob(void *data, int job)
+{
+    const MazeAgentsUpdate *update = (const MazeAgentsUpdate *)data;
+    MazeAgents *agents = update->agents;
+    MazeGrid grid = update->grid;
+    MazeDistanceField field = update->field;
+    float cellSize = update->cellSize;
+    float size = agents->size;
+    float speed = agents->speed;
+
+    // Neighbor cells offsets, checked in this order, first one closer to source is followed
+    static const Point offsets[4] = { { 0, -1 }, { 0, 1 }, { -1, 0 }, { 1, 0 } };
+
+    int start = job*MAZE_AGENTS_JOB_SIZE;
+    int end = start + MAZE_AGENTS_JOB_SIZE;
+    if (end > agents->count) end = agents->count;
+
+    for (int i = start; i < end; i++)
+    {
+        float x = agents->positionX[i];
+        float y = agents->positionY[i];
+        Vector2 center = { x + size/2.0f, y + size/2.0f };
+        int cellX = (int)floorf(center.x/cellSize);
+        int cellY = (int)floorf(center.y/cellSize);
+        unsigned int distance = GetMazeDistance(field, cellX, cellY);
+
+        // Get desired velocity from flow field, agents not reaching source stop
+        Vector2 desired = { 0.0f, 0.0f };
+
+        if (distance != MAZE_DISTANCE_UNREACHABLE)
+        {
+            Vector2 goal = update->target;
+
+            for (int n = 0; (n < 4) && (distance > 0); n++)
+            {
+                if (GetMazeDistance(field, cellX + offsets[n].x, cellY + offsets[n].y) == (distance - 1))
+                {
+                    goal = (Vector2){ (cellX + offsets[n].x + 0.5f)*cellSize, (cellY + offsets[n].y + 0.5f)*cellSize };
+                    break;
+                }
+            }
+
+            // Full speed towards goal, slowing down on arrival
+            Vector2 direction = { goal.x - center.x, goal.y - center.y };
+            float length = sqrtf(direction.x*direction.x + direction.y*direction.y);
+
+            if (length > speed) desired = (Vector2){ direction.x*speed/length, direction.y*speed/length };
+            else desired = direction;
+        }
+
+        float velocityX = agents->velocityX[i] + (desired.x - agents->velocityX[i])*MAZE_AGENT_STEERING;
+        float velocityY = agents->velocityY[i] + (desired.y - agents->velocityY[i])*MAZE_AGENT_STEERING;
+
+        MazeMoveResult move = MoveMazeBox(grid, cellSize, (Rectangle){ x, y, size, size }, (Vector2){ velocityX, velocityY });
+
+        // Velocity is lost on walls hit, so agents do not keep pushing against them
+        if (move.hitX) velocityX = 0.0f;
+        if (move.hitY) velocityY = 0.0f;
+
+        agents->previousX[i] = x;
+        agents->previousY[i] = y;
+        agents->positionX[i] = move.box.x;
+        agents->positionY[i] = move.box.y;
+        agents->velocityX[i] = velocityX;
+        agents->velocityY[i] = velocityY;
+
+        // Animation only runs while moving
+        if ((velocityX != 0.0f) || (velocityY != 0.0f))
+        {
+            agents->frameTimes[i] += update->deltaTime;
+
+            if (agents->frameTimes[i] >= MAZE_AGENT_FRAME_TIME)
+            {
+                agents->frameTimes[i] = 0.0f;
+                agents->frames[i] = (unsigned char)((agents->frames[i] + 1)%MAZE_AGENT_FRAMES);
+            }
+        }
+    }
+}
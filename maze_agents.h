@@ -0,0 +1,70 @@
+/*******************************************************************************************
+*
+*   maze_agents - Maze agents (chasers) steered by a shared flow field
+*
+*   Agents data is stored as struct of arrays (positions, velocities, animation frames),
+*   all agents steer towards the same target following one distance field (flow field),
+*   so no per-agent pathfinding is required: every agent moves to the neighbor cell one
+*   step closer to the field source, whatever the agents count
+*
+*   Agents are updated in parallel jobs of MAZE_AGENTS_JOB_SIZE agents, every agent only
+*   reads shared data (grid, field) and writes its own data, so results never depend on
+*   the threads used; jobs run on the persistent maze_jobs workers (InitMazeJobs()),
+*   so updating every tick only wakes them, no threads are created per update
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#ifndef MAZE_AGENTS_H
+#define MAZE_AGENTS_H
+
+#include "maze_grid.h"      // Required for: MazeGrid, Point
+#include "maze_path.h"      // Required for: MazeDistanceField, GetMazeDistance()
+
+#define MAZE_AGENTS_JOB_SIZE        1024        // Agents updated by every parallel job
+#define MAZE_AGENT_FRAMES           3           // Animation frames per direction
+#define MAZE_AGENT_FRAME_TIME       0.1f        // Animation frame duration, in seconds
+#define MAZE_AGENT_STEERING         0.25f       // Velocity change towards desired velocity, per update [0.0f..1.0f]
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Maze agents, struct of arrays, agent i data is at index i of every array
+typedef struct MazeAgents {
+    int count;                  // Agents added
+    int capacity;               // Agents allocated
+    float size;                 // Agents box size (square), in pixels
+    float speed;                // Agents max speed, in pixels per update
+    float *positionX;           // Box top-left, grid local coordinates
+    float *positionY;
+    float *previousX;           // Position before last update, for interpolated rendering
+    float *previousY;
+    float *velocityX;           // Velocity, in pixels per update
+    float *velocityY;
+    float *frameTimes;          // Time on current animation frame
+    unsigned char *frames;      // Animation frame [0..MAZE_AGENT_FRAMES - 1]
+} MazeAgents;
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+MazeAgents LoadMazeAgents(int capacity, float size, float speed);      // Load agents store, all arrays allocated at once
+void UnloadMazeAgents(MazeAgents agents);                               // Unload agents store from memory (RAM)
+void ClearMazeAgents(MazeAgents *agents);                               // Remove all agents, keeping memory
+
+int AddMazeAgent(MazeAgents *agents, Vector2 position, int frame);      // Add agent at position (box top-left), returns index, -1 if store is full
+
+// Update agents, moving them towards field source (target in source cell) resolving collisions against walls
+// NOTE: Field must be computed on grid, positions in grid local coordinates; if threadCount <= 0, all jobs pool workers are used
+void UpdateMazeAgents(MazeAgents *agents, MazeGrid grid, float cellSize, MazeDistanceField field, Vector2 target, float deltaTime, int threadCount);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // MAZE_AGENTS_H
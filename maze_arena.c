@@ -0,0 +1,40 @@
+/*******************************************************************************************
+*
+*   maze_arena - Linear memory arena, for data sharing the same lifetime
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "maze_arena.h"
+
+#include <stdlib.h>     // Required for: malloc(), free()
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Load arena, allocating its memory block
+MazeArena LoadMazeArena(size_t capacity)
+{
+    MazeArena arena = { 0 };
+
+    if (capacity > 0)
+    {
+        arena.memory = (unsigned char *)malloc(capacity);
+        if (arena.memory != NULL) arena.capacity = capacity;
+    }
+
+    return arena;
+}
+
+// Unload arena memory block from memory (RAM)
+void UnloadMazeArena(MazeArena arena)
+{
+    free(arena.memory);
+}
+
+// Free all arena allocations at once, keeping memory block
+void ResetMazeArena(MazeArena *arena)
+{
+    arena->used = 0;
+}
@@ -0,0 +1,61 @@
+/*******************************************************************************************
+*
+*   maze_arena - Linear memory arena, for data sharing the same lifetime
+*
+*   Memory is allocated once and handed out linearly, every allocation is freed at once
+*   by resetting the arena, so data loaded and unloaded again and again (i.e. level data
+*   on every level restart) costs no heap allocations once the arena is big enough
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#ifndef MAZE_ARENA_H
+#define MAZE_ARENA_H
+
+#include <stddef.h>         // Required for: size_t
+
+#define MAZE_ARENA_ALIGNMENT    16      // Alignment of every allocation, valid for any data type
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Linear memory arena
+typedef struct MazeArena {
+    unsigned char *memory;      // Arena memory block
+    size_t capacity;            // Arena memory size in bytes
+    size_t used;                // Bytes allocated, next allocation offset
+    size_t peak;                // Max bytes allocated since arena was loaded
+} MazeArena;
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+MazeArena LoadMazeArena(size_t capacity);       // Load arena, allocating its memory block
+void UnloadMazeArena(MazeArena arena);          // Unload arena memory block from memory (RAM)
+void ResetMazeArena(MazeArena *arena);          // Free all arena allocations at once, keeping memory block
+
+// Allocate memory from arena, NULL if arena has not enough space left
+// NOTE: Memory is not initialized; allocations done after a saved arena->used value can be
+// freed (i.e. temporary working memory) setting arena->used back to that value
+static inline void *AllocMazeArena(MazeArena *arena, size_t size)
+{
+    size_t offset = (arena->used + (MAZE_ARENA_ALIGNMENT - 1)) & ~(size_t)(MAZE_ARENA_ALIGNMENT - 1);
+
+    if ((arena->memory == NULL) || (offset > arena->capacity) || (size > (arena->capacity - offset))) return NULL;
+
+    arena->used = offset + size;
+    if (arena->used > arena->peak) arena->peak = arena->used;
+
+    return arena->memory + offset;
+}
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // MAZE_ARENA_H
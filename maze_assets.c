@@ -0,0 +1,411 @@
+/*******************************************************************************************
+*
+*   maze_assets - Asynchronous assets loading, textures and music streams
+*
+*   NOTE: Uses pthreads (available in MinGW/w64devkit through winpthreads),
+*   define MAZE_NO_THREADS to decode assets in main thread, one per frame
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "maze_assets.h"
+
+#include "rlgl.h"           // Required for: rlLoadTexture()
+
+#include <string.h>         // Required for: strncpy()
+
+#if !defined(MAZE_NO_THREADS)
+    #include <pthread.h>    // Required for: pthread_create(), pthread_mutex_lock(), pthread_cond_wait()...
+#endif
+
+#define MAX_ASSET_FILENAME  256
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Asset data
+// NOTE: Workers only access assets in MAZE_ASSET_DECODING state, any other state
+// is only changed by main thread, state changes are guarded by assetsMutex
+typedef struct MazeAsset {
+    MazeAssetType type;
+    char fileName[MAX_ASSET_FILENAME];
+    MazeAssetState state;           // Loading state
+    bool requested;                 // Asset required, cleared on eviction
+    Image image;                    // Decoded image (texture assets), until fully uploaded
+    unsigned char *fileData;        // File data (music assets), kept while music stream is loaded
+    int fileDataSize;
+    Texture2D texture;              // GPU texture (texture assets)
+    int uploadedRows;               // Texture rows already uploaded to GPU
+    Music music;                    // Music stream (music assets)
+} MazeAsset;
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static MazeAsset assets[MAX_MAZE_ASSETS] = { 0 };
+static int assetCount = 0;
+
+#if !defined(MAZE_NO_THREADS)
+static pthread_mutex_t assetsMutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t assetsQueued = PTHREAD_COND_INITIALIZER;     // Signaled when an asset is queued or on closing
+static pthread_t assetsWorkers[MAZE_ASSETS_WORKERS] = { 0 };
+static int assetsWorkerCount = 0;
+static bool assetsClosing = false;
+
+    #define LOCK_ASSETS()       pthread_mutex_lock(&assetsMutex)
+    #define UNLOCK_ASSETS()     pthread_mutex_unlock(&assetsMutex)
+#else
+    #define LOCK_ASSETS()
+    #define UNLOCK_ASSETS()
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Declaration
+//----------------------------------------------------------------------------------
+static bool DecodeMazeAsset(MazeAsset *asset);                  // Decode asset file, music streams are created (no GPU required)
+static void UnloadMazeAssetData(MazeAsset *asset);              // Unload all asset data, decoded or uploaded
+static MazeAsset *GetQueuedMazeAsset(void);                     // Get first queued asset, NULL if none
+#if !defined(MAZE_NO_THREADS)
+static void *MazeAssetsWorker(void *arg);                       // Decoding worker thread
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Init assets manager, launching decoding workers
+void InitMazeAssets(void)
+{
+#if !defined(MAZE_NO_THREADS)
+    assetsClosing = false;
+
+    for (int i = 0; i < MAZE_ASSETS_WORKERS; i++)
+    {
+        if (pthread_create(&assetsWorkers[assetsWorkerCount], NULL, MazeAssetsWorker, NULL) == 0) assetsWorkerCount++;
+    }
+
+    if (assetsWorkerCount == 0) TraceLog(LOG_WARNING, "ASSETS: Decoding workers could not be launched");
+#endif
+}
+
+// Close assets manager, unloading all assets
+void CloseMazeAssets(void)
+{
+#if !defined(MAZE_NO_THREADS)
+    LOCK_ASSETS();
+    assetsClosing = true;
+    pthread_cond_broadcast(&assetsQueued);
+    UNLOCK_ASSETS();
+
+    for (int i = 0; i < assetsWorkerCount; i++) pthread_join(assetsWorkers[i], NULL);
+
+    assetsWorkerCount = 0;
+#endif
+
+    for (int i = 0; i < assetCount; i++)
+    {
+        UnloadMazeAssetData(&assets[i]);
+        assets[i] = (MazeAsset){ 0 };
+    }
+
+    assetCount = 0;
+}
+
+// Register asset (not loaded), returns asset id, -1 on failure
+int AddMazeAsset(MazeAssetType type, const char *fileName)
+{
+    if ((assetCount >= MAX_MAZE_ASSETS) || (fileName == NULL)) return -1;
+
+    LOCK_ASSETS();
+    MazeAsset *asset = &assets[assetCount];
+
+    *asset = (MazeAsset){ 0 };
+    asset->type = type;
+    strncpy(asset->fileName, fileName, MAX_ASSET_FILENAME - 1);
+
+    int id = assetCount++;
+    UNLOCK_ASSETS();
+
+    return id;
+}
+
+// Request asset loading, if not loaded or requested
+void RequestMazeAsset(int id)
+{
+    if ((id < 0) || (id >= assetCount)) return;
+
+    MazeAsset *asset = &assets[id];
+
+    LOCK_ASSETS();
+    asset->requested = true;
+
+    if (asset->state == MAZE_ASSET_UNLOADED)
+    {
+        asset->state = MAZE_ASSET_QUEUED;
+#if !defined(MAZE_NO_THREADS)
+        pthread_cond_signal(&assetsQueued);
+#endif
+    }
+    UNLOCK_ASSETS();
+}
+
+// Unload asset data from RAM/VRAM, can be requested again
+// NOTE: Assets being decoded are discarded once decoded
+void EvictMazeAsset(int id)
+{
+    if ((id < 0) || (id >= assetCount)) return;
+
+    MazeAsset *asset = &assets[id];
+
+    LOCK_ASSETS();
+    asset->requested = false;
+    MazeAssetState state = asset->state;
+
+    if (state == MAZE_ASSET_QUEUED) asset->state = MAZE_ASSET_UNLOADED;
+    UNLOCK_ASSETS();
+
+    if ((state != MAZE_ASSET_UNLOADED) && (state != MAZE_ASSET_QUEUED) && (state != MAZE_ASSET_DECODING))
+    {
+        UnloadMazeAssetData(asset);
+
+        LOCK_ASSETS();
+        asset->state = MAZE_ASSET_UNLOADED;
+        UNLOCK_ASSETS();
+    }
+}
+
+// Process decoded assets, uploading textures slices (call once per frame)
+// NOTE: Texture uploads are limited to MAZE_ASSETS_UPLOAD_BUDGET bytes per call,
+// so big textures never stall a frame
+void UpdateMazeAssets(void)
+{
+#if defined(MAZE_NO_THREADS)
+    // No workers available, decode one queued asset per frame
+    MazeAsset *queued = GetQueuedMazeAsset();
+
+    if (queued != NULL) queued->state = DecodeMazeAsset(queued)? MAZE_ASSET_DECODED : MAZE_ASSET_FAILED;
+#endif
+
+    int uploadBudget = MAZE_ASSETS_UPLOAD_BUDGET;
+
+    for (int i = 0; i < assetCount; i++)
+    {
+        MazeAsset *asset = &assets[i];
+
+        LOCK_ASSETS();
+        MazeAssetState state = asset->state;
+        UNLOCK_ASSETS();
+
+        MazeAssetState previousState = state;
+
+        if (state == MAZE_ASSET_DECODED)
+        {
+            // Asset evicted while being decoded
+            if (!asset->requested)
+            {
+                UnloadMazeAssetData(asset);
+                state = MAZE_ASSET_UNLOADED;
+            }
+            else if (asset->type == MAZE_ASSET_TEXTURE)
+            {
+                Image image = asset->image;
+
+                if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
+                {
+                    // Compressed images can not be uploaded by rows, full upload required
+                    asset->texture = LoadTextureFromImage(image);
+                    UnloadImage(asset->image);
+                    asset->image = (Image){ 0 };
+                    state = (asset->texture.id > 0)? MAZE_ASSET_READY : MAZE_ASSET_FAILED;
+                }
+                else
+                {
+                    // Texture storage allocated on GPU, no data uploaded yet
+                    asset->texture.id = rlLoadTexture(NULL, image.width, image.height, image.format, 1);
+                    asset->texture.width = image.width;
+                    asset->texture.height = image.height;
+                    asset->texture.mipmaps = 1;
+                    asset->texture.format = image.format;
+                    asset->uploadedRows = 0;
+
+                    if (asset->texture.id > 0) state = MAZE_ASSET_UPLOADING;
+                    else
+                    {
+                        UnloadMazeAssetData(asset);
+                        state = MAZE_ASSET_FAILED;
+                    }
+                }
+            }
+            else if (asset->type == MAZE_ASSET_MUSIC) state = MAZE_ASSET_READY;     // Music stream created on decoding
+        }
+
+        if ((state == MAZE_ASSET_UPLOADING) && (uploadBudget > 0))
+        {
+            Image image = asset->image;
+            int rowSize = GetPixelDataSize(image.width, 1, image.format);
+            int rows = uploadBudget/rowSize;
+
+            if (rows < 1) rows = 1;
+            if (rows > (image.height - asset->uploadedRows)) rows = image.height - asset->uploadedRows;
+
+            UpdateTextureRec(asset->texture, (Rectangle){ 0, (float)asset->uploadedRows, (float)image.width, (float)rows },
+                (unsigned char *)image.data + (size_t)asset->uploadedRows*rowSize);
+
+            asset->uploadedRows += rows;
+            uploadBudget -= rows*rowSize;
+
+            if (asset->uploadedRows >= image.height)
+            {
+                // Image data not required any more, texture is fully uploaded
+                UnloadImage(asset->image);
+                asset->image = (Image){ 0 };
+                state = MAZE_ASSET_READY;
+            }
+        }
+
+        // NOTE: State only written back when changed here, queued assets could be
+        // taken by a worker meanwhile and their state must not be overwritten
+        if (state != previousState)
+        {
+            LOCK_ASSETS();
+            asset->state = state;
+            UNLOCK_ASSETS();
+        }
+    }
+}
+
+// Get asset loading state
+MazeAssetState GetMazeAssetState(int id)
+{
+    if ((id < 0) || (id >= assetCount)) return MAZE_ASSET_FAILED;
+
+    LOCK_ASSETS();
+    MazeAssetState state = assets[id].state;
+    UNLOCK_ASSETS();
+
+    return state;
+}
+
+// Check if asset is ready to be used
+bool IsMazeAssetReady(int id)
+{
+    return (GetMazeAssetState(id) == MAZE_ASSET_READY);
+}
+
+// Get requested assets loading progress [0.0f..1.0f]
+// NOTE: Failed assets are considered done
+float GetMazeAssetsProgress(void)
+{
+    int requested = 0;
+    int done = 0;
+
+    LOCK_ASSETS();
+    for (int i = 0; i < assetCount; i++)
+    {
+        if (assets[i].requested)
+        {
+            requested++;
+            if ((assets[i].state == MAZE_ASSET_READY) || (assets[i].state == MAZE_ASSET_FAILED)) done++;
+        }
+    }
+    UNLOCK_ASSETS();
+
+    return (requested > 0)? (float)done/requested : 1.0f;
+}
+
+// Get asset texture, empty texture if not ready
+Texture2D GetMazeAssetTexture(int id)
+{
+    return (IsMazeAssetReady(id) && (assets[id].type == MAZE_ASSET_TEXTURE))? assets[id].texture : (Texture2D){ 0 };
+}
+
+// Get asset music stream, empty music if not ready
+Music GetMazeAssetMusic(int id)
+{
+    return (IsMazeAssetReady(id) && (assets[id].type == MAZE_ASSET_MUSIC))? assets[id].music : (Music){ 0 };
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+// Decode asset file, music streams are created (no GPU required)
+static bool DecodeMazeAsset(MazeAsset *asset)
+{
+    if (asset->type == MAZE_ASSET_TEXTURE)
+    {
+        asset->image = LoadImage(asset->fileName);
+        return (asset->image.data != NULL);
+    }
+    else if (asset->type == MAZE_ASSET_MUSIC)
+    {
+        // NOTE: Music stream creation scans the whole file (i.e. MP3 frames count), done here out of main thread;
+        // music stream reads file data while playing, data is kept until asset is unloaded
+        asset->fileData = LoadFileData(asset->fileName, &asset->fileDataSize);
+
+        if (asset->fileData != NULL) asset->music = LoadMusicStreamFromMemory(GetFileExtension(asset->fileName), asset->fileData, asset->fileDataSize);
+
+        return (asset->music.ctxData != NULL);
+    }
+
+    return false;
+}
+
+// Unload all asset data, decoded or uploaded
+static void UnloadMazeAssetData(MazeAsset *asset)
+{
+    if (asset->image.data != NULL) UnloadImage(asset->image);
+    if (asset->texture.id > 0) UnloadTexture(asset->texture);
+    if (asset->music.ctxData != NULL) UnloadMusicStream(asset->music);
+    if (asset->fileData != NULL) UnloadFileData(asset->fileData);
+
+    asset->image = (Image){ 0 };
+    asset->texture = (Texture2D){ 0 };
+    asset->music = (Music){ 0 };
+    asset->fileData = NULL;
+    asset->fileDataSize = 0;
+    asset->uploadedRows = 0;
+}
+
+// Get first queued asset, NULL if none
+static MazeAsset *GetQueuedMazeAsset(void)
+{
+    for (int i = 0; i < assetCount; i++)
+    {
+        if (assets[i].state == MAZE_ASSET_QUEUED) return &assets[i];
+    }
+
+    return NULL;
+}
+
+#if !defined(MAZE_NO_THREADS)
+// Decoding worker thread, waits for queued assets until closing
+static void *MazeAssetsWorker(void *arg)
+{
+    (void)arg;
+
+    LOCK_ASSETS();
+
+    while (!assetsClosing)
+    {
+        MazeAsset *asset = GetQueuedMazeAsset();
+
+        if (asset == NULL)
+        {
+            pthread_cond_wait(&assetsQueued, &assetsMutex);
+            continue;
+        }
+
+        asset->state = MAZE_ASSET_DECODING;
+        UNLOCK_ASSETS();
+
+        bool decoded = DecodeMazeAsset(asset);
+
+        LOCK_ASSETS();
+        asset->state = decoded? MAZE_ASSET_DECODED : MAZE_ASSET_FAILED;
+    }
+
+    UNLOCK_ASSETS();
+
+    return NULL;
+}
+#endif
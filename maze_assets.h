@@ -0,0 +1,70 @@
+/*******************************************************************************************
+*
+*   maze_assets - Asynchronous assets loading, textures and music streams
+*
+*   Assets are registered by file name and loaded on request:
+*     - Worker threads decode image files and load music streams (no GPU use)
+*     - Main thread uploads decoded images to GPU in rows slices, limited per frame
+*   Loaded assets can be evicted at any time, freeing RAM/VRAM, and requested again later
+*
+*   WARNING: All functions must be called from main thread (the one owning GPU context)
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#ifndef MAZE_ASSETS_H
+#define MAZE_ASSETS_H
+
+#include "raylib.h"
+
+#define MAX_MAZE_ASSETS             32          // Max assets registered
+#define MAZE_ASSETS_WORKERS         2           // Decoding worker threads
+#define MAZE_ASSETS_UPLOAD_BUDGET   (256*1024)  // Max texture bytes uploaded to GPU per frame
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Asset types
+typedef enum MazeAssetType {
+    MAZE_ASSET_TEXTURE = 0,         // Image file, uploaded to GPU as texture
+    MAZE_ASSET_MUSIC,               // Music file, played as music stream
+} MazeAssetType;
+
+// Asset loading states
+typedef enum MazeAssetState {
+    MAZE_ASSET_UNLOADED = 0,        // Not loaded, nor requested
+    MAZE_ASSET_QUEUED,              // Waiting for a worker
+    MAZE_ASSET_DECODING,            // Being decoded by a worker
+    MAZE_ASSET_DECODED,             // Decoded, waiting for main thread
+    MAZE_ASSET_UPLOADING,           // Texture being uploaded to GPU, in slices
+    MAZE_ASSET_READY,               // Ready to be used
+    MAZE_ASSET_FAILED,              // File could not be loaded
+} MazeAssetState;
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+void InitMazeAssets(void);                                      // Init assets manager, launching decoding workers
+void CloseMazeAssets(void);                                     // Close assets manager, unloading all assets
+
+int AddMazeAsset(MazeAssetType type, const char *fileName);     // Register asset (not loaded), returns asset id, -1 on failure
+void RequestMazeAsset(int id);                                  // Request asset loading, if not loaded or requested
+void EvictMazeAsset(int id);                                    // Unload asset data from RAM/VRAM, can be requested again
+void UpdateMazeAssets(void);                                    // Process decoded assets, uploading textures slices (call once per frame)
+
+MazeAssetState GetMazeAssetState(int id);                       // Get asset loading state
+bool IsMazeAssetReady(int id);                                  // Check if asset is ready to be used
+float GetMazeAssetsProgress(void);                              // Get requested assets loading progress [0.0f..1.0f]
+Texture2D GetMazeAssetTexture(int id);                          // Get asset texture, empty texture if not ready
+Music GetMazeAssetMusic(int id);                                // Get asset music stream, empty music if not ready
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // MAZE_ASSETS_H
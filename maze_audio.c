@@ -0,0 +1,280 @@
+/*******************************************************************************************
+*
+*   maze_audio - Music streaming on a dedicated audio thread
+*
+*   NOTE: Commands queue is a single-producer single-consumer ring buffer: main thread only
+*   writes commands and the write counter, audio thread only reads commands and writes the
+*   read counter, so no lock is ever taken and no thread waits for the other one
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+    #define _POSIX_C_SOURCE 199309L     // Required for: nanosleep()
+#endif
+
+#include "maze_audio.h"
+
+#include <stddef.h>         // Required for: NULL
+#include <stdatomic.h>      // Required for: atomic_uint, atomic_load_explicit(), atomic_store_explicit()...
+
+#if !defined(MAZE_NO_THREADS)
+    #include <pthread.h>    // Required for: pthread_create(), pthread_join()
+    #include <time.h>       // Required for: nanosleep()
+#endif
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Audio command types
+typedef enum MazeAudioCommandType {
+    MAZE_AUDIO_PLAY = 0,
+    MAZE_AUDIO_STOP,
+    MAZE_AUDIO_PAUSE,
+    MAZE_AUDIO_RESUME,
+    MAZE_AUDIO_SEEK,
+    MAZE_AUDIO_VOLUME,
+} MazeAudioCommandType;
+
+// Audio command, sent from main thread to audio thread
+typedef struct MazeAudioCommand {
+    MazeAudioCommandType type;
+    Music music;                    // Music to play (MAZE_AUDIO_PLAY)
+    float value;                    // Seek position or volume (MAZE_AUDIO_SEEK, MAZE_AUDIO_VOLUME)
+} MazeAudioCommand;
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static MazeAudioCommand audioCommands[MAZE_AUDIO_QUEUE_SIZE] = { 0 };
+static atomic_uint audioCommandsWritten = 0;    // Commands queued, only written by main thread
+static atomic_uint audioCommandsRead = 0;       // Commands processed, only written by audio thread
+
+// NOTE: Music state is only accessed by audio thread (main thread once audio thread is closed)
+static Music audioMusic = { 0 };                // Music playing
+static float audioVolume = 1.0f;                // Volume for music played
+
+// Music times published by audio thread, in milliseconds
+static atomic_int audioTimePlayed = 0;
+static atomic_int audioTimeLength = 0;
+
+#if !defined(MAZE_NO_THREADS)
+static pthread_t audioThread;
+static bool audioThreadRunning = false;
+static atomic_bool audioClosing = false;
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Declaration
+//----------------------------------------------------------------------------------
+static bool PushAudioCommand(MazeAudioCommandType type, Music music, float value);   // Queue command (main thread), false if queue is full
+static bool PopAudioCommand(MazeAudioCommand *command);         // Get next queued command (audio thread), false if none
+static void UpdateAudioStreaming(void);                         // Process queued commands and refill music stream buffers
+#if !defined(MAZE_NO_THREADS)
+static void *MazeAudioThread(void *arg);                        // Audio streaming thread
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Init audio streaming thread (audio device must be initialized)
+void InitMazeAudio(void)
+{
+#if !defined(MAZE_NO_THREADS)
+    atomic_store(&audioClosing, false);
+
+    audioThreadRunning = (pthread_create(&audioThread, NULL, MazeAudioThread, NULL) == 0);
+
+    if (!audioThreadRunning) TraceLog(LOG_WARNING, "AUDIO: Streaming thread could not be launched, music streamed on main thread");
+#endif
+}
+
+// Close audio streaming thread, music is stopped
+void CloseMazeAudio(void)
+{
+#if !defined(MAZE_NO_THREADS)
+    if (audioThreadRunning)
+    {
+        atomic_store(&audioClosing, true);
+        pthread_join(audioThread, NULL);
+        audioThreadRunning = false;
+    }
+#endif
+
+    // Commands still queued are discarded, music is owned by caller, only stopped
+    if (audioMusic.ctxData != NULL) StopMusicStream(audioMusic);
+
+    audioMusic = (Music){ 0 };
+    atomic_store(&audioCommandsRead, atomic_load(&audioCommandsWritten));
+    atomic_store(&audioTimePlayed, 0);
+    atomic_store(&audioTimeLength, 0);
+}
+
+// Update music streaming in main thread (only required with MAZE_NO_THREADS)
+// NOTE: Safe to be called every frame, nothing is done if audio thread is running
+void UpdateMazeAudio(void)
+{
+#if !defined(MAZE_NO_THREADS)
+    if (audioThreadRunning) return;
+#endif
+
+    UpdateAudioStreaming();
+}
+
+// Play music stream, replacing music playing
+bool PlayMazeMusic(Music music)
+{
+    return PushAudioCommand(MAZE_AUDIO_PLAY, music, 0.0f);
+}
+
+// Stop music playing
+bool StopMazeMusic(void)
+{
+    return PushAudioCommand(MAZE_AUDIO_STOP, (Music){ 0 }, 0.0f);
+}
+
+// Pause music playing
+bool PauseMazeMusic(void)
+{
+    return PushAudioCommand(MAZE_AUDIO_PAUSE, (Music){ 0 }, 0.0f);
+}
+
+// Resume paused music
+bool ResumeMazeMusic(void)
+{
+    return PushAudioCommand(MAZE_AUDIO_RESUME, (Music){ 0 }, 0.0f);
+}
+
+// Seek music to a position (in seconds)
+bool SeekMazeMusic(float position)
+{
+    return PushAudioCommand(MAZE_AUDIO_SEEK, (Music){ 0 }, position);
+}
+
+// Set music volume (1.0 is max level)
+bool SetMazeMusicVolume(float volume)
+{
+    return PushAudioCommand(MAZE_AUDIO_VOLUME, (Music){ 0 }, volume);
+}
+
+// Get music time played (in seconds), updated by audio thread
+float GetMazeMusicTimePlayed(void)
+{
+    return (float)atomic_load_explicit(&audioTimePlayed, memory_order_relaxed)/1000.0f;
+}
+
+// Get music time length (in seconds), 0.0f if no music playing
+float GetMazeMusicTimeLength(void)
+{
+    return (float)atomic_load_explicit(&audioTimeLength, memory_order_relaxed)/1000.0f;
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+// Queue command (main thread), false if queue is full
+static bool PushAudioCommand(MazeAudioCommandType type, Music music, float value)
+{
+    unsigned int written = atomic_load_explicit(&audioCommandsWritten, memory_order_relaxed);
+    unsigned int read = atomic_load_explicit(&audioCommandsRead, memory_order_acquire);
+
+    if ((written - read) >= MAZE_AUDIO_QUEUE_SIZE)
+    {
+        TraceLog(LOG_WARNING, "AUDIO: Commands queue is full, command discarded");
+        return false;
+    }
+
+    MazeAudioCommand *command = &audioCommands[written & (MAZE_AUDIO_QUEUE_SIZE - 1)];
+    command->type = type;
+    command->music = music;
+    command->value = value;
+
+    // NOTE: Release store, command data is visible to audio thread before the new counter
+    atomic_store_explicit(&audioCommandsWritten, written + 1, memory_order_release);
+
+    return true;
+}
+
+// Get next queued command (audio thread), false if none
+static bool PopAudioCommand(MazeAudioCommand *command)
+{
+    unsigned int read = atomic_load_explicit(&audioCommandsRead, memory_order_relaxed);
+    unsigned int written = atomic_load_explicit(&audioCommandsWritten, memory_order_acquire);
+
+    if (read == written) return false;
+
+    *command = audioCommands[read & (MAZE_AUDIO_QUEUE_SIZE - 1)];
+
+    // NOTE: Release store, slot is only reused by main thread once command is copied
+    atomic_store_explicit(&audioCommandsRead, read + 1, memory_order_release);
+
+    return true;
+}
+
+// Process queued commands and refill music stream buffers
+static void UpdateAudioStreaming(void)
+{
+    MazeAudioCommand command = { 0 };
+
+    while (PopAudioCommand(&command))
+    {
+        switch (command.type)
+        {
+            case MAZE_AUDIO_PLAY:
+            {
+                if (audioMusic.ctxData != NULL) StopMusicStream(audioMusic);
+
+                audioMusic = command.music;
+
+                if (audioMusic.ctxData != NULL)
+                {
+                    SetMusicVolume(audioMusic, audioVolume);
+                    PlayMusicStream(audioMusic);
+                    atomic_store_explicit(&audioTimeLength, (int)(GetMusicTimeLength(audioMusic)*1000.0f), memory_order_relaxed);
+                }
+            } break;
+            case MAZE_AUDIO_STOP:
+            {
+                if (audioMusic.ctxData != NULL) StopMusicStream(audioMusic);
+
+                audioMusic = (Music){ 0 };
+                atomic_store_explicit(&audioTimePlayed, 0, memory_order_relaxed);
+                atomic_store_explicit(&audioTimeLength, 0, memory_order_relaxed);
+            } break;
+            case MAZE_AUDIO_PAUSE: if (audioMusic.ctxData != NULL) PauseMusicStream(audioMusic); break;
+            case MAZE_AUDIO_RESUME: if (audioMusic.ctxData != NULL) ResumeMusicStream(audioMusic); break;
+            case MAZE_AUDIO_SEEK: if (audioMusic.ctxData != NULL) SeekMusicStream(audioMusic, command.value); break;
+            case MAZE_AUDIO_VOLUME:
+            {
+                audioVolume = command.value;
+                if (audioMusic.ctxData != NULL) SetMusicVolume(audioMusic, audioVolume);
+            } break;
+            default: break;
+        }
+    }
+
+    if (audioMusic.ctxData != NULL)
+    {
+        UpdateMusicStream(audioMusic);      // Refill processed stream buffers, decoding music data
+        atomic_store_explicit(&audioTimePlayed, (int)(GetMusicTimePlayed(audioMusic)*1000.0f), memory_order_relaxed);
+    }
+}
+
+#if !defined(MAZE_NO_THREADS)
+// Audio streaming thread, updates music streaming periodically until closing
+static void *MazeAudioThread(void *arg)
+{
+    (void)arg;
+
+    struct timespec period = { 0, MAZE_AUDIO_UPDATE_MS*1000000L };
+
+    while (!atomic_load(&audioClosing))
+    {
+        UpdateAudioStreaming();
+        nanosleep(&period, NULL);
+    }
+
+    return NULL;
+}
+#endif
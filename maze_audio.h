@@ -0,0 +1,52 @@
+/*******************************************************************************************
+*
+*   maze_audio - Music streaming on a dedicated audio thread
+*
+*   Music stream buffers are refilled by an audio thread, independently of game mode and
+*   frame timing, so long frames never starve the stream and stream decoding never runs
+*   on main thread; main thread controls music through a lock-free commands queue
+*
+*   WARNING: Commands must be sent from one thread only (main thread), music streams
+*   played must not be used by any other function while played by the audio thread
+*
+*   NOTE: Define MAZE_NO_THREADS to stream music in main thread, on UpdateMazeAudio()
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#ifndef MAZE_AUDIO_H
+#define MAZE_AUDIO_H
+
+#include "raylib.h"
+
+#define MAZE_AUDIO_QUEUE_SIZE       64      // Commands queue size, must be power of 2
+#define MAZE_AUDIO_UPDATE_MS        5       // Audio thread update period, in milliseconds
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+void InitMazeAudio(void);                   // Init audio streaming thread (audio device must be initialized)
+void CloseMazeAudio(void);                  // Close audio streaming thread, music is stopped
+void UpdateMazeAudio(void);                 // Update music streaming in main thread (only required with MAZE_NO_THREADS)
+
+// Music commands, queued to audio thread, return false if queue is full
+bool PlayMazeMusic(Music music);            // Play music stream, replacing music playing
+bool StopMazeMusic(void);                   // Stop music playing
+bool PauseMazeMusic(void);                  // Pause music playing
+bool ResumeMazeMusic(void);                 // Resume paused music
+bool SeekMazeMusic(float position);         // Seek music to a position (in seconds)
+bool SetMazeMusicVolume(float volume);      // Set music volume (1.0 is max level)
+
+float GetMazeMusicTimePlayed(void);         // Get music time played (in seconds), updated by audio thread
+float GetMazeMusicTimeLength(void);         // Get music time length (in seconds), 0.0f if no music playing
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // MAZE_AUDIO_H
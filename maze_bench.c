@@ -0,0 +1,753 @@
+/*******************************************************************************************
+*
+*   raylib maze game - Performance regression benchmarks
+*
+*   Measures core maze operations: generation (all algorithms, several sizes and seeds),
+*   collision probes, item lookups and pickups, chasers update, editor paint (and texture
+*   upload) and game mode tiles drawing (hidden window, offscreen render target); every benchmark is
+*   run several times and its median run is reported, as CSV (one line per benchmark)
+*
+*   Results can be saved and used as baseline for later runs: every benchmark slower than
+*   baseline by more than its threshold is reported as a regression (exit code 2)
+*
+*   USAGE: maze_bench [options]
+*       --repeat <runs>             Timed runs per benchmark, median is reported (default: 5)
+*       --filter <text>             Only run benchmarks with text in their name
+*       --output <file>             Save results to file (CSV), to be used as baseline
+*       --baseline <file>           Compare results against baseline results file (CSV)
+*       --threshold <percent>       Max slowdown against baseline for all benchmarks (default: 10)
+*       --threshold <name>=<percent>  Max slowdown for benchmarks starting with name (longest name applies)
+*       --no-gpu                    Skip benchmarks requiring a window (texture upload, tiles draw)
+*       --quick                     Smaller sizes and fewer seeds, for fast checks
+*
+*   NOTE: Results depend on machine, only compare against baselines saved on same machine
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+#include "rlgl.h"               // Required for: rlDrawRenderBatchActive()
+
+#include "maze_grid.h"          // Required for: MazeGrid, FillMazeGrid(), GenMazeGridRows()...
+#include "maze_collision.h"     // Required for: MoveMazeBox(), CheckMazeBoxWalls()
+#include "maze_items.h"         // Required for: MazeItems, AddMazeItem(), RemoveMazeItem(), GetMazeItem()
+#include "maze_edit.h"          // Required for: MazeEditJournal, EditMazeGridLine(), UpdateMazeEditBatch()...
+#include "maze_path.h"          // Required for: MazeDistanceField, UpdateMazeDistanceField()...
+#include "maze_visibility.h"    // Required for: MazeVisibility, UpdateMazeVisibility()
+#include "maze_agents.h"        // Required for: MazeAgents, AddMazeAgent(), UpdateMazeAgents()
+#include "maze_render.h"        // Required for: DrawMazeTiles(), LoadMazeTexture(), UpdateMazeTexture()...
+#include "maze_jobs.h"          // Required for: InitMazeJobs(), CloseMazeJobs()
+#include "maze_profiler.h"      // Required for: GetMazeTime()
+
+#include <stdio.h>              // Required for: printf(), fprintf(), fopen(), fgets(), sscanf()
+#include <stdlib.h>             // Required for: malloc(), free(), atoi(), atof(), qsort()
+#include <string.h>             // Required for: strcmp(), strstr(), strncmp(), strchr(), strlen()
+
+#define MAX_BENCH_RESULTS       64          // Max benchmarks results stored
+#define MAX_BENCH_THRESHOLDS    16          // Max per-benchmark thresholds
+#define MAX_BENCH_REPEAT        100         // Max timed runs per benchmark
+#define MAX_BENCH_NAME          64
+
+#define BENCH_SEED              67218       // First seed, all benchmarks data is generated from it
+#define BENCH_SCREEN_WIDTH      1280        // Hidden window and render target size, same as game screen
+#define BENCH_SCREEN_HEIGHT     720
+#define BENCH_CELL_SIZE         10.0f       // Cell size in pixels, same as game MAZE_SCALE
+#define BENCH_PROBES            1000000     // Collision probes and item lookups per run
+#define BENCH_DRAW_FRAMES       60          // Frames drawn per tiles draw run
+#define BENCH_AGENTS            10000       // Chasers updated, same as game AGENT_COUNT
+#define BENCH_AGENT_TICKS       60          // Simulation ticks per chasers update run
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Benchmark run function, all benchmark operations done once
+typedef void (*BenchFunc)(void *data);
+
+// Benchmark result
+typedef struct BenchResult {
+    char name[MAX_BENCH_NAME];
+    long long ops;              // Operations per run
+    double medianTime;          // Median run time, in seconds
+    double minTime;             // Fastest run time, in seconds
+} BenchResult;
+
+// Regression threshold for benchmarks starting with name
+typedef struct BenchThreshold {
+    char name[MAX_BENCH_NAME];
+    float percent;
+} BenchThreshold;
+
+// Generation benchmark: maze generated for every seed into the same grid
+typedef struct GenBench {
+    MazeGrid grid;
+    MazeGenConfig config;
+    int seedCount;
+} GenBench;
+
+// Streamed generation benchmark: rows consumed as generated, walls counted
+typedef struct StreamBench {
+    int width;
+    int height;
+    long long wallCount;
+} StreamBench;
+
+// Collision benchmark: boxes moved from random floor cells
+typedef struct CollisionBench {
+    MazeGrid grid;
+    Rectangle *boxes;
+    Vector2 *deltas;
+    int count;
+    int hits;                   // Probes result, so no probe is optimized away
+} CollisionBench;
+
+// Items benchmark: items store lookups (and pickups) of random cells
+typedef struct ItemsBench {
+    MazeItems items;
+    Point *cells;
+    int count;
+    int found;
+} ItemsBench;
+
+// Chasers benchmark: all chasers updated every tick, following flow field to level center
+typedef struct AgentsBench {
+    MazeAgents agents;
+    MazeGrid grid;
+    MazeDistanceField field;
+    Vector2 target;
+    const Rectangle *spawns;    // Chasers spawn boxes (random floor cells), chasers spawned again on every run
+    int ticks;
+} AgentsBench;
+
+// Editor benchmark: brush strokes applied to level grid, as in game editor mode
+typedef struct EditBench {
+    MazeGrid grid;
+    MazeEditJournal journal;
+    MazeDistanceField field;
+    MazeDirtyRegion dirty;
+    Texture texMaze;            // Updated after every stroke if upload is set
+    bool upload;
+    Point *strokes;             // Stroke start and end cells
+    int strokeCount;
+    int runCount;               // Runs done, strokes kind alternates between runs
+} EditBench;
+
+// Tiles draw benchmark: game mode frames drawn to an offscreen render target
+typedef struct DrawBench {
+    MazeGrid grid;
+    MazeVisibility *visibility;
+    Texture texAtlas;
+    RenderTexture target;
+    Camera2D camera;
+    int frames;
+    int batches;
+} DrawBench;
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static BenchResult results[MAX_BENCH_RESULTS] = { 0 };
+static int resultCount = 0;
+static int benchRepeat = 5;
+static const char *benchFilter = NULL;
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+static int CompareTimes(const void *a, const void *b);                                  // Compare run times, for sorting
+static void RunBenchmark(const char *name, BenchFunc func, void *data, long long ops);  // Run benchmark (warm-up and timed runs), storing result
+static bool SaveBenchResults(const char *fileName);                                     // Save results to file (CSV)
+static int CompareBenchResults(const char *fileName, const BenchThreshold *thresholds, int thresholdCount, float defaultThreshold);  // Compare results against baseline, returns regressions
+
+static void RunGenBench(void *data);            // Generate maze for every seed
+static void RunStreamBench(void *data);         // Generate streamed maze
+static void CountStreamRow(const unsigned char *cells, int width, int y, void *userData);   // Count row walls (row callback)
+static void RunCollisionBench(void *data);      // Move every box
+static void RunWallsBench(void *data);          // Check every box overlaps walls
+static void RunItemLookupBench(void *data);     // Look up every cell
+static void RunItemPickupBench(void *data);     // Pick up and place back every cell item
+static void RunAgentsBench(void *data);         // Update all chasers every tick
+static void RunEditBench(void *data);           // Apply every stroke (and upload texture)
+static void RunUploadBench(void *data);         // Upload whole maze texture
+static void RunDrawBench(void *data);           // Draw frames to render target
+
+//----------------------------------------------------------------------------------
+// Main entry point
+//----------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    const char *outputFileName = NULL;
+    const char *baselineFileName = NULL;
+    BenchThreshold thresholds[MAX_BENCH_THRESHOLDS] = { 0 };
+    int thresholdCount = 0;
+    float defaultThreshold = 10.0f;
+    bool useGpu = true;
+    bool quick = false;
+
+    // Parse command line options
+    for (int i = 1; i < argc; i++)
+    {
+        bool hasValue = (i + 1) < argc;
+
+        if ((strcmp(argv[i], "--repeat") == 0) && hasValue) benchRepeat = atoi(argv[++i]);
+        else if ((strcmp(argv[i], "--filter") == 0) && hasValue) benchFilter = argv[++i];
+        else if ((strcmp(argv[i], "--output") == 0) && hasValue) outputFileName = argv[++i];
+        else if ((strcmp(argv[i], "--baseline") == 0) && hasValue) baselineFileName = argv[++i];
+        else if ((strcmp(argv[i], "--threshold") == 0) && hasValue)
+        {
+            const char *value = argv[++i];
+            const char *separator = strchr(value, '=');
+
+            if (separator == NULL) defaultThreshold = (float)atof(value);
+            else if ((thresholdCount < MAX_BENCH_THRESHOLDS) && ((separator - value) < MAX_BENCH_NAME))
+            {
+                memcpy(thresholds[thresholdCount].name, value, separator - value);
+                thresholds[thresholdCount].percent = (float)atof(separator + 1);
+                thresholdCount++;
+            }
+        }
+        else if (strcmp(argv[i], "--no-gpu") == 0) useGpu = false;
+        else if (strcmp(argv[i], "--quick") == 0) quick = true;
+        else
+        {
+            fprintf(stderr, "Unknown or incomplete option: %s\n", argv[i]);
+            fprintf(stderr, "USAGE: %s [--repeat n] [--filter text] [--output file] [--baseline file] [--threshold [name=]percent] [--no-gpu] [--quick]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    if ((benchRepeat < 1) || (benchRepeat > MAX_BENCH_REPEAT))
+    {
+        fprintf(stderr, "Invalid runs per benchmark: must be 1..%i\n", MAX_BENCH_REPEAT);
+        return 1;
+    }
+
+    SetTraceLogLevel(LOG_WARNING);
+    InitMazeJobs(0);        // Workers launched once, not timed by any benchmark
+
+    // Hidden window, only required for texture upload and drawing benchmarks
+    if (useGpu)
+    {
+        SetConfigFlags(FLAG_WINDOW_HIDDEN);
+        InitWindow(BENCH_SCREEN_WIDTH, BENCH_SCREEN_HEIGHT, "maze bench");
+
+        if (!IsWindowReady())
+        {
+            fprintf(stderr, "Window could not be initialized, GPU benchmarks skipped\n");
+            useGpu = false;
+        }
+    }
+
+    printf("name,ops,median_ms,min_ms,ns_per_op,ops_per_s\n");
+
+    // Generation: every algorithm, several sizes, several seeds per run, same grid memory
+    //--------------------------------------------------------------------------------------
+    const int genSizes[3] = { 256, 1024, 2048 };
+    int genSizeCount = quick? 2 : 3;
+    int seedCount = quick? 1 : 3;
+
+    for (int s = 0; s < genSizeCount; s++)
+    {
+        for (int a = 0; a < MAZE_GEN_ALGORITHMS; a++)
+        {
+            GenBench gen = { 0 };
+            gen.grid = LoadMazeGrid(genSizes[s], genSizes[s]);
+            gen.config = (MazeGenConfig){ a, BENCH_SEED, 4, 4, 0.75f, 0 };
+            gen.seedCount = seedCount;
+
+            // Small mazes use more seeds, so every run generates at least 1M cells (timer precision)
+            if (genSizes[s]*genSizes[s] < (1 << 20)) gen.seedCount *= (1 << 20)/(genSizes[s]*genSizes[s]);
+
+            RunBenchmark(TextFormat("gen_%s_%i", GetMazeGenAlgorithmName(a), genSizes[s]), RunGenBench, &gen, (long long)genSizes[s]*genSizes[s]*gen.seedCount);
+
+            UnloadMazeGrid(gen.grid);
+        }
+    }
+
+    StreamBench stream = { 4096, quick? 1024 : 16384, 0 };
+    RunBenchmark(TextFormat("gen_eller_stream_%ix%i", stream.width, stream.height), RunStreamBench, &stream, (long long)stream.width*stream.height);
+
+    // Collision and items: level sized maze, probes from random floor cells
+    //--------------------------------------------------------------------------------------
+    MazeGrid level = GenMazeGridParallel(1024, 1024, 4, 4, 0.75f, BENCH_SEED, 0);
+    MazeRandom rng = InitMazeRandom(BENCH_SEED, 1);
+    int probeCount = quick? BENCH_PROBES/10 : BENCH_PROBES;
+
+    CollisionBench collision = { 0 };
+    collision.grid = level;
+    collision.count = probeCount;
+    collision.boxes = (Rectangle *)malloc(probeCount*sizeof(Rectangle));
+    collision.deltas = (Vector2 *)malloc(probeCount*sizeof(Vector2));
+
+    ItemsBench items = { 0 };
+    items.items = LoadMazeItems(1024);
+    items.count = probeCount;
+    items.cells = (Point *)malloc(probeCount*sizeof(Point));
+
+    for (int i = 0; i < probeCount; i++)
+    {
+        Point cell = { 0 };
+
+        do cell = (Point){ GetMazeRandomValue(&rng, 1, level.width - 2), GetMazeRandomValue(&rng, 1, level.height - 2) };
+        while (GetMazeCell(level, cell.x, cell.y) == MAZE_CELL_WALL);
+
+        // Player sized boxes, moving at player speed in any direction
+        collision.boxes[i] = (Rectangle){ cell.x*BENCH_CELL_SIZE + 1.0f, cell.y*BENCH_CELL_SIZE + 1.0f, 7.0f, 7.0f };
+        collision.deltas[i] = (Vector2){ GetMazeRandomValue(&rng, -300, 300)/100.0f, GetMazeRandomValue(&rng, -300, 300)/100.0f };
+
+        // Half of lookups hit an item (one item every 8 floor cells probed)
+        items.cells[i] = cell;
+        if ((i%8) == 0) AddMazeItem(&items.items, cell, 50);
+    }
+
+    for (int i = 0; i < probeCount; i += 2) items.cells[i] = items.cells[(i/2/4)*8];
+
+    RunBenchmark("collision_move", RunCollisionBench, &collision, probeCount);
+    RunBenchmark("collision_walls", RunWallsBench, &collision, probeCount);
+    RunBenchmark("item_lookup", RunItemLookupBench, &items, probeCount);
+    RunBenchmark("item_pickup", RunItemPickupBench, &items, probeCount);
+
+    // Chasers: game chasers count following player flow field, updated in parallel jobs every tick
+    //--------------------------------------------------------------------------------------
+    AgentsBench agents = { 0 };
+    Point center = { level.width/2, level.height/2 };
+
+    while (GetMazeCell(level, center.x, center.y) == MAZE_CELL_WALL) center.x++;
+
+    agents.grid = level;
+    agents.field = LoadMazeDistanceField(level, center);
+    agents.agents = LoadMazeAgents(BENCH_AGENTS, 5.0f, 1.5f);
+    agents.target = (Vector2){ (center.x + 0.5f)*BENCH_CELL_SIZE, (center.y + 0.5f)*BENCH_CELL_SIZE };
+    agents.spawns = collision.boxes;    // NOTE: At least BENCH_AGENTS probes, even with --quick
+    agents.ticks = quick? BENCH_AGENT_TICKS/4 : BENCH_AGENT_TICKS;
+
+    RunBenchmark("agents_update", RunAgentsBench, &agents, (long long)BENCH_AGENTS*agents.ticks);
+
+    UnloadMazeAgents(agents.agents);
+    UnloadMazeDistanceField(agents.field);
+
+    // Editor: brush strokes on a level, distance field kept updated, as in editor mode
+    //--------------------------------------------------------------------------------------
+    EditBench edit = { 0 };
+    edit.grid = GenMazeGridParallel(256, 256, 4, 4, 0.75f, BENCH_SEED, 0);
+    edit.journal = LoadMazeEditJournal(0);
+    edit.field = LoadMazeDistanceField(edit.grid, (Point){ 1, 1 });
+    edit.strokeCount = quick? 50 : 250;
+    edit.strokes = (Point *)malloc(edit.strokeCount*2*sizeof(Point));
+
+    // Brush strokes are short segments (mouse moved in one frame), some of them single cells
+    for (int i = 0; i < edit.strokeCount; i++)
+    {
+        Point start = { GetMazeRandomValue(&rng, 1, edit.grid.width - 2), GetMazeRandomValue(&rng, 1, edit.grid.height - 2) };
+        Point end = start;
+
+        if ((i%4) != 0)
+        {
+            end.x = start.x + GetMazeRandomValue(&rng, -8, 8);
+            end.y = start.y + GetMazeRandomValue(&rng, -8, 8);
+        }
+
+        edit.strokes[2*i] = start;
+        edit.strokes[2*i + 1] = end;
+    }
+
+    RunBenchmark("edit_paint", RunEditBench, &edit, edit.strokeCount);
+
+    if (useGpu)
+    {
+        edit.texMaze = LoadMazeTexture(edit.grid);
+        edit.upload = true;
+        RunBenchmark("edit_paint_upload", RunEditBench, &edit, edit.strokeCount);
+        UnloadTexture(edit.texMaze);
+
+        // Whole level texture update, i.e. level reset or big fill
+        EditBench upload = { 0 };
+        upload.grid = level;
+        upload.texMaze = LoadMazeTexture(level);
+        RunBenchmark("texture_upload_1024", RunUploadBench, &upload, (long long)level.width*level.height);
+        UnloadTexture(upload.texMaze);
+    }
+
+    // Tiles draw: game mode frames (camera following player, default and zoomed out), fog of war
+    //--------------------------------------------------------------------------------------
+    if (useGpu)
+    {
+        Texture texAtlas = LoadTexture("resources/maze_atlas01.png");
+
+        if (texAtlas.id == 0)
+        {
+            Image imAtlas = GenImageChecked(64, 64, 32, 32, GRAY, DARKGRAY);
+            texAtlas = LoadTextureFromImage(imAtlas);
+            UnloadImage(imAtlas);
+        }
+
+        MazeVisibility visibility = LoadMazeVisibility(level.width, level.height, 12);
+
+        DrawBench draw = { 0 };
+        draw.grid = level;
+        draw.texAtlas = texAtlas;
+        draw.target = LoadRenderTexture(BENCH_SCREEN_WIDTH, BENCH_SCREEN_HEIGHT);
+        draw.frames = quick? BENCH_DRAW_FRAMES/4 : BENCH_DRAW_FRAMES;
+        draw.camera.offset = (Vector2){ BENCH_SCREEN_WIDTH/2.0f, BENCH_SCREEN_HEIGHT/2.0f };
+        draw.camera.target = (Vector2){ level.width*BENCH_CELL_SIZE/2.0f, level.height*BENCH_CELL_SIZE/2.0f };
+
+        const float zooms[2] = { 1.0f, 0.5f };
+
+        for (int z = 0; z < 2; z++)
+        {
+            draw.camera.zoom = zooms[z];
+            draw.visibility = NULL;
+            RunBenchmark(TextFormat("tile_draw_zoom%i", (int)(zooms[z]*100)), RunDrawBench, &draw, draw.frames);
+        }
+
+        // Explored area around player, as when playing
+        for (int x = 0; x < level.width; x += 8) UpdateMazeVisibility(&visibility, level, (Point){ x, level.height/2 });
+
+        draw.camera.zoom = 1.0f;
+        draw.visibility = &visibility;
+        RunBenchmark("tile_draw_fog", RunDrawBench, &draw, draw.frames);
+
+        UnloadMazeVisibility(visibility);
+        UnloadRenderTexture(draw.target);
+        UnloadTexture(texAtlas);
+    }
+
+    // Results and baseline comparison
+    //--------------------------------------------------------------------------------------
+    int regressions = 0;
+
+    if ((outputFileName != NULL) && !SaveBenchResults(outputFileName)) fprintf(stderr, "Results could not be saved to: %s\n", outputFileName);
+    if (baselineFileName != NULL) regressions = CompareBenchResults(baselineFileName, thresholds, thresholdCount, defaultThreshold);
+
+    UnloadMazeGrid(level);
+    UnloadMazeGrid(edit.grid);
+    UnloadMazeEditJournal(edit.journal);
+    UnloadMazeDistanceField(edit.field);
+    UnloadMazeItems(items.items);
+    free(collision.boxes);
+    free(collision.deltas);
+    free(items.cells);
+    free(edit.strokes);
+
+    CloseMazeJobs();
+    if (useGpu) CloseWindow();
+
+    if (regressions < 0) return 1;
+
+    return (regressions > 0)? 2 : 0;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Compare run times, for sorting
+static int CompareTimes(const void *a, const void *b)
+{
+    double timeA = *(const double *)a;
+    double timeB = *(const double *)b;
+
+    return (timeA > timeB) - (timeA < timeB);
+}
+
+// Run benchmark (one warm-up run, then timed runs), storing result and printing it (CSV)
+// NOTE: Benchmarks not matching filter are skipped
+static void RunBenchmark(const char *name, BenchFunc func, void *data, long long ops)
+{
+    if ((benchFilter != NULL) && (strstr(name, benchFilter) == NULL)) return;
+    if (resultCount >= MAX_BENCH_RESULTS) return;
+
+    double times[MAX_BENCH_REPEAT] = { 0 };
+
+    func(data);     // Warm-up: caches, lazy allocations, GPU driver state
+
+    for (int i = 0; i < benchRepeat; i++)
+    {
+        double startTime = GetMazeTime();
+        func(data);
+        times[i] = GetMazeTime() - startTime;
+    }
+
+    qsort(times, benchRepeat, sizeof(double), CompareTimes);
+
+    BenchResult *result = &results[resultCount++];
+
+    strncpy(result->name, name, MAX_BENCH_NAME - 1);
+    result->ops = ops;
+    result->medianTime = times[benchRepeat/2];
+    result->minTime = times[0];
+
+    printf("%s,%lld,%.3f,%.3f,%.2f,%.0f\n", result->name, result->ops, result->medianTime*1000.0, result->minTime*1000.0,
+        result->medianTime*1e9/ops, (result->medianTime > 0.0)? ops/result->medianTime : 0.0);
+    fflush(stdout);
+}
+
+// Save results to file (CSV), same format than printed results
+static bool SaveBenchResults(const char *fileName)
+{
+    FILE *file = fopen(fileName, "wt");
+
+    if (file == NULL) return false;
+
+    fprintf(file, "name,ops,median_ms,min_ms,ns_per_op,ops_per_s\n");
+
+    for (int i = 0; i < resultCount; i++)
+    {
+        fprintf(file, "%s,%lld,%.3f,%.3f,%.2f,%.0f\n", results[i].name, results[i].ops, results[i].medianTime*1000.0, results[i].minTime*1000.0,
+            results[i].medianTime*1e9/results[i].ops, (results[i].medianTime > 0.0)? results[i].ops/results[i].medianTime : 0.0);
+    }
+
+    fclose(file);
+
+    return true;
+}
+
+// Compare results against baseline results file (CSV), printing comparison (CSV), returns regressions found (-1 on error)
+// NOTE: Benchmarks are compared by time per operation, benchmarks not found in baseline are reported as new
+static int CompareBenchResults(const char *fileName, const BenchThreshold *thresholds, int thresholdCount, float defaultThreshold)
+{
+    FILE *file = fopen(fileName, "rt");
+
+    if (file == NULL)
+    {
+        fprintf(stderr, "Baseline file could not be loaded: %s\n", fileName);
+        return -1;
+    }
+
+    char names[MAX_BENCH_RESULTS][MAX_BENCH_NAME] = { 0 };
+    double baseTimes[MAX_BENCH_RESULTS] = { 0 };
+    int baseCount = 0;
+    char line[256] = { 0 };
+
+    while ((baseCount < MAX_BENCH_RESULTS) && (fgets(line, sizeof(line), file) != NULL))
+    {
+        long long ops = 0;
+        double medianTime = 0.0, minTime = 0.0, opTime = 0.0;
+
+        // Header and invalid lines are skipped
+        if (sscanf(line, "%63[^,],%lld,%lf,%lf,%lf", names[baseCount], &ops, &medianTime, &minTime, &opTime) == 5)
+        {
+            baseTimes[baseCount] = opTime;
+            baseCount++;
+        }
+    }
+
+    fclose(file);
+
+    int regressions = 0;
+
+    printf("\nname,baseline_ns_per_op,ns_per_op,change_pct,threshold_pct,status\n");
+
+    for (int i = 0; i < resultCount; i++)
+    {
+        double opTime = results[i].medianTime*1e9/results[i].ops;
+
+        // Threshold of longest name matching benchmark name start
+        float threshold = defaultThreshold;
+        int thresholdLength = 0;
+
+        for (int t = 0; t < thresholdCount; t++)
+        {
+            int length = (int)strlen(thresholds[t].name);
+
+            if ((length > thresholdLength) && (strncmp(results[i].name, thresholds[t].name, length) == 0))
+            {
+                threshold = thresholds[t].percent;
+                thresholdLength = length;
+            }
+        }
+
+        int base = -1;
+        for (int b = 0; b < baseCount; b++) if (strcmp(names[b], results[i].name) == 0) base = b;
+
+        if ((base < 0) || (baseTimes[base] <= 0.0))
+        {
+            printf("%s,,%.2f,,%.1f,new\n", results[i].name, opTime, threshold);
+            continue;
+        }
+
+        double change = (opTime - baseTimes[base])*100.0/baseTimes[base];
+        bool regression = (change > threshold);
+
+        if (regression) regressions++;
+
+        printf("%s,%.2f,%.2f,%.1f,%.1f,%s\n", results[i].name, baseTimes[base], opTime, change, threshold, regression? "regression" : "ok");
+    }
+
+    printf("\nregressions: %i\n", regressions);
+
+    return regressions;
+}
+
+// Generate maze for every seed, into the same grid
+static void RunGenBench(void *data)
+{
+    GenBench *gen = (GenBench *)data;
+    MazeGenConfig config = gen->config;
+
+    for (int i = 0; i < gen->seedCount; i++)
+    {
+        config.seed = gen->config.seed + i;
+        FillMazeGrid(gen->grid, config);
+    }
+}
+
+// Generate streamed maze, rows consumed as generated
+static void RunStreamBench(void *data)
+{
+    StreamBench *stream = (StreamBench *)data;
+
+    stream->wallCount = 0;
+    GenMazeGridRows(stream->width, stream->height, BENCH_SEED, CountStreamRow, stream);
+}
+
+// Count row walls (row callback)
+static void CountStreamRow(const unsigned char *cells, int width, int y, void *userData)
+{
+    StreamBench *stream = (StreamBench *)userData;
+
+    (void)y;
+
+    for (int x = 0; x < width; x++) stream->wallCount += (cells[x] == MAZE_CELL_WALL);
+}
+
+// Move every box, from its start position
+static void RunCollisionBench(void *data)
+{
+    CollisionBench *collision = (CollisionBench *)data;
+    int hits = 0;
+
+    for (int i = 0; i < collision->count; i++)
+    {
+        MazeMoveResult move = MoveMazeBox(collision->grid, BENCH_CELL_SIZE, collision->boxes[i], collision->deltas[i]);
+
+        hits += move.hitX + move.hitY;
+    }
+
+    collision->hits = hits;
+}
+
+// Check every box (moved by its delta) overlaps walls
+static void RunWallsBench(void *data)
+{
+    CollisionBench *collision = (CollisionBench *)data;
+    int hits = 0;
+
+    for (int i = 0; i < collision->count; i++)
+    {
+        Rectangle box = collision->boxes[i];
+
+        box.x += collision->deltas[i].x;
+        box.y += collision->deltas[i].y;
+        hits += CheckMazeBoxWalls(collision->grid, BENCH_CELL_SIZE, box);
+    }
+
+    collision->hits = hits;
+}
+
+// Look up every cell in items store
+static void RunItemLookupBench(void *data)
+{
+    ItemsBench *items = (ItemsBench *)data;
+    int found = 0;
+
+    for (int i = 0; i < items->count; i++) found += (GetMazeItem(items->items, items->cells[i]) != NULL);
+
+    items->found = found;
+}
+
+// Pick up every cell item (if any) and place it back, store is left unchanged
+static void RunItemPickupBench(void *data)
+{
+    ItemsBench *items = (ItemsBench *)data;
+    int found = 0;
+
+    for (int i = 0; i < items->count; i++)
+    {
+        MazeItem item = { 0 };
+
+        if (RemoveMazeItem(&items->items, items->cells[i], &item))
+        {
+            AddMazeItem(&items->items, item.cell, item.value);
+            found++;
+        }
+    }
+
+    items->found = found;
+}
+
+// Update all chasers every tick, as game simulation, chasers spawned at same boxes on every run
+static void RunAgentsBench(void *data)
+{
+    AgentsBench *agents = (AgentsBench *)data;
+
+    ClearMazeAgents(&agents->agents);
+    for (int i = 0; i < BENCH_AGENTS; i++) AddMazeAgent(&agents->agents, (Vector2){ agents->spawns[i].x, agents->spawns[i].y }, i);
+
+    for (int i = 0; i < agents->ticks; i++) UpdateMazeAgents(&agents->agents, agents->grid, BENCH_CELL_SIZE, agents->field, agents->target, 1.0f/60.0f, 0);
+}
+
+// Apply every brush stroke as an editor frame: cells edited and recorded, dirty region and distance
+// field updated with UpdateMazeEditBatch() (same as editor), texture updated with dirty region if upload is set
+// NOTE: Strokes alternate walls and floor, swapped on every run, so strokes always change cells
+// and grid keeps a similar walls ratio along runs
+static void RunEditBench(void *data)
+{
+    EditBench *edit = (EditBench *)data;
+
+    ClearMazeEditJournal(&edit->journal);
+
+    for (int i = 0; i < edit->strokeCount; i++)
+    {
+        MazeCell kind = (((i + edit->runCount)%2) == 0)? MAZE_CELL_WALL : MAZE_CELL_FLOOR;
+
+        BeginMazeEdit(&edit->journal);
+        EditMazeGridLine(&edit->journal, &edit->grid, edit->strokes[2*i], edit->strokes[2*i + 1], kind);
+        MazeEditBatch batch = EndMazeEdit(&edit->journal);
+
+        MazeDistanceField *fields[1] = { &edit->field };
+        UpdateMazeEditBatch(&edit->journal, batch, edit->grid, &edit->dirty, fields, 1);
+
+        if (edit->upload) UpdateMazeTexture(edit->texMaze, edit->grid, &edit->dirty);
+        else edit->dirty.dirty = false;
+    }
+
+    if (edit->upload) rlDrawRenderBatchActive();
+
+    edit->runCount++;
+}
+
+// Upload whole maze texture (all cells dirty)
+static void RunUploadBench(void *data)
+{
+    EditBench *upload = (EditBench *)data;
+
+    upload->dirty = (MazeDirtyRegion){ true, 0, 0, upload->grid.width - 1, upload->grid.height - 1 };
+    UpdateMazeTexture(upload->texMaze, upload->grid, &upload->dirty);
+}
+
+// Draw game mode frames to render target: maze tiles visible by camera, camera moving every frame
+// NOTE: Render target pixels are read back after last frame, so GPU work is included in run time
+static void RunDrawBench(void *data)
+{
+    DrawBench *draw = (DrawBench *)data;
+    Camera2D camera = draw->camera;
+    int batches = 0;
+
+    for (int i = 0; i < draw->frames; i++)
+    {
+        camera.target.x = draw->camera.target.x + (float)i;
+
+        BeginTextureMode(draw->target);
+            ClearBackground(RAYWHITE);
+
+            BeginMode2D(camera);
+                batches += DrawMazeTiles(draw->grid, draw->texAtlas, (Vector2){ 0.0f, 0.0f }, BENCH_CELL_SIZE, camera, draw->visibility);
+            EndMode2D();
+        EndTextureMode();
+    }
+
+    Image image = LoadImageFromTexture(draw->target.texture);
+    UnloadImage(image);
+
+    draw->batches = batches;
+}
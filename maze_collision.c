@@ -0,0 +1,162 @@
+/*******************************************************************************************
+*
+*   maze_collision - Swept AABB collision against maze grid wall cells
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "maze_collision.h"
+
+#include <math.h>       // Required for: floorf(), ceilf()
+
+// Tolerance for box edges lying on cell borders, in cells
+// NOTE: Avoids float rounding making a box edge touching a wall be considered inside it
+#define EDGE_EPSILON    1e-4f
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Declaration
+//----------------------------------------------------------------------------------
+static bool IsWallInColumn(MazeGrid grid, int column, int startRow, int endRow);    // Check wall cells in column rows range
+static bool IsWallInRow(MazeGrid grid, int row, int startColumn, int endColumn);    // Check wall cells in row columns range
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Move box by delta, stopping at walls, box in grid local coordinates (cell (0, 0) top-left at origin)
+// NOTE: Horizontal movement is resolved first, then vertical movement from the new position,
+// so diagonal moves slide along walls
+MazeMoveResult MoveMazeBox(MazeGrid grid, float cellSize, Rectangle box, Vector2 delta)
+{
+    MazeMoveResult result = { box, false, false };
+    Rectangle *moved = &result.box;
+
+    // Horizontal sweep, checking every column entered by the leading edge
+    if (delta.x != 0.0f)
+    {
+        int startRow = (int)floorf(moved->y/cellSize + EDGE_EPSILON);
+        int endRow = (int)ceilf((moved->y + moved->height)/cellSize - EDGE_EPSILON) - 1;
+
+        if (delta.x > 0.0f)
+        {
+            float edge = moved->x + moved->width;
+            int firstColumn = (int)ceilf(edge/cellSize - EDGE_EPSILON);
+            int lastColumn = (int)ceilf((edge + delta.x)/cellSize - EDGE_EPSILON) - 1;
+
+            moved->x += delta.x;
+
+            for (int column = firstColumn; column <= lastColumn; column++)
+            {
+                if (IsWallInColumn(grid, column, startRow, endRow))
+                {
+                    moved->x = column*cellSize - moved->width;
+                    result.hitX = true;
+                    break;
+                }
+            }
+        }
+        else
+        {
+            int firstColumn = (int)floorf(moved->x/cellSize + EDGE_EPSILON) - 1;
+            int lastColumn = (int)floorf((moved->x + delta.x)/cellSize + EDGE_EPSILON);
+
+            moved->x += delta.x;
+
+            for (int column = firstColumn; column >= lastColumn; column--)
+            {
+                if (IsWallInColumn(grid, column, startRow, endRow))
+                {
+                    moved->x = (column + 1)*cellSize;
+                    result.hitX = true;
+                    break;
+                }
+            }
+        }
+    }
+
+    // Vertical sweep from the new horizontal position, checking every row entered by the leading edge
+    if (delta.y != 0.0f)
+    {
+        int startColumn = (int)floorf(moved->x/cellSize + EDGE_EPSILON);
+        int endColumn = (int)ceilf((moved->x + moved->width)/cellSize - EDGE_EPSILON) - 1;
+
+        if (delta.y > 0.0f)
+        {
+            float edge = moved->y + moved->height;
+            int firstRow = (int)ceilf(edge/cellSize - EDGE_EPSILON);
+            int lastRow = (int)ceilf((edge + delta.y)/cellSize - EDGE_EPSILON) - 1;
+
+            moved->y += delta.y;
+
+            for (int row = firstRow; row <= lastRow; row++)
+            {
+                if (IsWallInRow(grid, row, startColumn, endColumn))
+                {
+                    moved->y = row*cellSize - moved->height;
+                    result.hitY = true;
+                    break;
+                }
+            }
+        }
+        else
+        {
+            int firstRow = (int)floorf(moved->y/cellSize + EDGE_EPSILON) - 1;
+            int lastRow = (int)floorf((moved->y + delta.y)/cellSize + EDGE_EPSILON);
+
+            moved->y += delta.y;
+
+            for (int row = firstRow; row >= lastRow; row--)
+            {
+                if (IsWallInRow(grid, row, startColumn, endColumn))
+                {
+                    moved->y = (row + 1)*cellSize;
+                    result.hitY = true;
+                    break;
+                }
+            }
+        }
+    }
+
+    return result;
+}
+
+// Check if box overlaps any wall cell, box in grid local coordinates
+bool CheckMazeBoxWalls(MazeGrid grid, float cellSize, Rectangle box)
+{
+    int startRow = (int)floorf(box.y/cellSize + EDGE_EPSILON);
+    int endRow = (int)ceilf((box.y + box.height)/cellSize - EDGE_EPSILON) - 1;
+    int startColumn = (int)floorf(box.x/cellSize + EDGE_EPSILON);
+    int endColumn = (int)ceilf((box.x + box.width)/cellSize - EDGE_EPSILON) - 1;
+
+    for (int row = startRow; row <= endRow; row++)
+    {
+        if (IsWallInRow(grid, row, startColumn, endColumn)) return true;
+    }
+
+    return false;
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+// Check wall cells in column rows range
+static bool IsWallInColumn(MazeGrid grid, int column, int startRow, int endRow)
+{
+    for (int row = startRow; row <= endRow; row++)
+    {
+        if (GetMazeCell(grid, column, row) == MAZE_CELL_WALL) return true;
+    }
+
+    return false;
+}
+
+// Check wall cells in row columns range
+static bool IsWallInRow(MazeGrid grid, int row, int startColumn, int endColumn)
+{
+    for (int column = startColumn; column <= endColumn; column++)
+    {
+        if (GetMazeCell(grid, column, row) == MAZE_CELL_WALL) return true;
+    }
+
+    return false;
+}
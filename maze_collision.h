@@ -0,0 +1,45 @@
+/*******************************************************************************************
+*
+*   maze_collision - Swept AABB collision against maze grid wall cells
+*
+*   Boxes are moved one axis after the other in the same step, every cell column/row
+*   crossed by the box leading edge is checked, so no wall can be skipped (tunneling)
+*   whatever the speed; cells out of the grid are considered walls
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#ifndef MAZE_COLLISION_H
+#define MAZE_COLLISION_H
+
+#include "maze_grid.h"      // Required for: MazeGrid, GetMazeCell()
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Box movement result
+typedef struct MazeMoveResult {
+    Rectangle box;          // Box after movement, in grid local coordinates
+    bool hitX;              // Horizontal movement blocked by a wall
+    bool hitY;              // Vertical movement blocked by a wall
+} MazeMoveResult;
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+// Move box by delta, stopping at walls, box in grid local coordinates (cell (0, 0) top-left at origin)
+MazeMoveResult MoveMazeBox(MazeGrid grid, float cellSize, Rectangle box, Vector2 delta);
+
+// Check if box overlaps any wall cell, box in grid local coordinates
+bool CheckMazeBoxWalls(MazeGrid grid, float cellSize, Rectangle box);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // MAZE_COLLISION_H
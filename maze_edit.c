@@ -0,0 +1,414 @@
+/*******************************************************************************************
+*
+*   maze_edit - Maze editor bulk tools and undo/redo journal
+*
+*   NOTE: Consecutive changes are merged into the last run while possible, so a rectangle
+*   or flood fill over uniform cells is recorded as one run per row span
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "maze_edit.h"
+
+#include <stdlib.h>     // Required for: malloc(), realloc(), free(), abs()
+#include <string.h>     // Required for: memset(), memmove()
+
+#define MIN_EDIT_RUNS_CAPACITY      256
+#define MIN_EDIT_ENTRIES_CAPACITY   64
+#define MAX_EDIT_RUN_LENGTH         65535
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Declaration
+//----------------------------------------------------------------------------------
+static void RecordEditCell(MazeEditJournal *journal, int index, unsigned char before, unsigned char after);  // Record cell change, merged into last run if possible
+static MazeEditBatch GetEditBatch(const MazeEditJournal *journal, int firstRun, int runCount, bool undo);  // Get batch for a range of runs
+static void DropOldestEditEntries(MazeEditJournal *journal);                                                // Drop oldest entries until runs fit in budget
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Load edit journal, with a runs budget (0 for default)
+MazeEditJournal LoadMazeEditJournal(int maxRuns)
+{
+    MazeEditJournal journal = { 0 };
+
+    journal.maxRuns = (maxRuns > 0)? maxRuns : MAZE_EDIT_JOURNAL_RUNS;
+    journal.runCapacity = MIN_EDIT_RUNS_CAPACITY;
+    journal.runs = (MazeEditRun *)malloc(journal.runCapacity*sizeof(MazeEditRun));
+    journal.entryCapacity = MIN_EDIT_ENTRIES_CAPACITY;
+    journal.entries = (MazeEditEntry *)malloc(journal.entryCapacity*sizeof(MazeEditEntry));
+    journal.fieldCells = (Point *)malloc(MAZE_EDIT_FIELD_CELLS*sizeof(Point));
+
+    return journal;
+}
+
+// Unload edit journal from memory (RAM)
+void UnloadMazeEditJournal(MazeEditJournal journal)
+{
+    free(journal.runs);
+    free(journal.entries);
+    free(journal.fieldCells);
+}
+
+// Remove all entries, keeping memory
+void ClearMazeEditJournal(MazeEditJournal *journal)
+{
+    journal->runCount = 0;
+    journal->entryCount = 0;
+    journal->doneCount = 0;
+    journal->flushedRun = 0;
+    journal->recording = false;
+}
+
+// Begin recording a new entry, entries undone are discarded
+void BeginMazeEdit(MazeEditJournal *journal)
+{
+    if (journal->recording) return;
+
+    // New edit invalidates redo history
+    if (journal->doneCount < journal->entryCount)
+    {
+        journal->runCount = journal->entries[journal->doneCount].firstRun;
+        journal->entryCount = journal->doneCount;
+    }
+
+    if (journal->entryCount == journal->entryCapacity)
+    {
+        journal->entryCapacity *= 2;
+        journal->entries = (MazeEditEntry *)realloc(journal->entries, journal->entryCapacity*sizeof(MazeEditEntry));
+    }
+
+    journal->entries[journal->entryCount++] = (MazeEditEntry){ journal->runCount, 0 };
+    journal->flushedRun = journal->runCount;
+    journal->recording = true;
+}
+
+// Get changes recorded since last flush, entry is kept open
+// NOTE: Used to update derived data while an edit is in progress (i.e. brush strokes)
+MazeEditBatch FlushMazeEdit(MazeEditJournal *journal)
+{
+    if (!journal->recording) return (MazeEditBatch){ 0 };
+
+    MazeEditBatch batch = GetEditBatch(journal, journal->flushedRun, journal->runCount - journal->flushedRun, false);
+    journal->flushedRun = journal->runCount;
+
+    return batch;
+}
+
+// End recording entry, returns changes not flushed yet
+// NOTE: Entries with no changes are discarded, oldest entries are dropped if runs budget is exceeded
+MazeEditBatch EndMazeEdit(MazeEditJournal *journal)
+{
+    if (!journal->recording) return (MazeEditBatch){ 0 };
+
+    MazeEditEntry *entry = &journal->entries[journal->entryCount - 1];
+    entry->runCount = journal->runCount - entry->firstRun;
+
+    if (entry->runCount == 0) journal->entryCount--;
+
+    journal->doneCount = journal->entryCount;
+    journal->recording = false;
+
+    int pendingRuns = journal->runCount - journal->flushedRun;
+
+    DropOldestEditEntries(journal);
+
+    // NOTE: Batch taken after dropping entries, runs could have been moved
+    return GetEditBatch(journal, journal->runCount - pendingRuns, pendingRuns, false);
+}
+
+// Revert last applied entry, returns reverted changes
+MazeEditBatch UndoMazeEdit(MazeEditJournal *journal, MazeGrid *grid)
+{
+    if (journal->recording || (journal->doneCount == 0)) return (MazeEditBatch){ 0 };
+
+    MazeEditEntry entry = journal->entries[--journal->doneCount];
+
+    // Runs reverted in reverse order, so cells changed several times get their first kind
+    for (int i = entry.firstRun + entry.runCount - 1; i >= entry.firstRun; i--)
+    {
+        MazeEditRun run = journal->runs[i];
+        memset(grid->cells + run.index, run.before, run.length);
+    }
+
+    return GetEditBatch(journal, entry.firstRun, entry.runCount, true);
+}
+
+// Apply again last undone entry, returns applied changes
+MazeEditBatch RedoMazeEdit(MazeEditJournal *journal, MazeGrid *grid)
+{
+    if (journal->recording || (journal->doneCount == journal->entryCount)) return (MazeEditBatch){ 0 };
+
+    MazeEditEntry entry = journal->entries[journal->doneCount++];
+
+    for (int i = entry.firstRun; i < (entry.firstRun + entry.runCount); i++)
+    {
+        MazeEditRun run = journal->runs[i];
+        memset(grid->cells + run.index, run.after, run.length);
+    }
+
+    return GetEditBatch(journal, entry.firstRun, entry.runCount, false);
+}
+
+// Update data derived from batch cells: dirty region (if any) and distance fields, grid must be already changed
+// NOTE: Distance fields are updated incrementally with all batch cells at once (only cells depending on them
+// are recomputed), batches over MAZE_EDIT_FIELD_CELLS (large fills, rectangles) recompute whole fields once
+void UpdateMazeEditBatch(MazeEditJournal *journal, MazeEditBatch batch, MazeGrid grid, MazeDirtyRegion *dirty, MazeDistanceField **fields, int fieldCount)
+{
+    if (batch.runCount == 0) return;
+
+    int width = grid.width;
+
+    if (dirty != NULL)
+    {
+        for (int r = 0; r < batch.runCount; r++)
+        {
+            // Runs spanning several rows cover full rows
+            int last = batch.runs[r].index + batch.runs[r].length - 1;
+
+            if ((batch.runs[r].index/width) == (last/width)) AddMazeDirtyRegion(dirty, batch.runs[r].index%width, batch.runs[r].index/width, last%width, last/width);
+            else AddMazeDirtyRegion(dirty, 0, batch.runs[r].index/width, width - 1, last/width);
+        }
+    }
+
+    if (fieldCount == 0) return;
+
+    if ((batch.cellCount <= MAZE_EDIT_FIELD_CELLS) && (journal->fieldCells != NULL))
+    {
+        Point *cells = journal->fieldCells;
+        int cellCount = 0;
+
+        for (int r = 0; r < batch.runCount; r++)
+        {
+            for (int i = batch.runs[r].index; i < (batch.runs[r].index + batch.runs[r].length); i++) cells[cellCount++] = (Point){ i%width, i/width };
+        }
+
+        for (int f = 0; f < fieldCount; f++) UpdateMazeDistanceFieldCells(fields[f], grid, cells, cellCount);
+    }
+    else
+    {
+        for (int f = 0; f < fieldCount; f++) ResetMazeDistanceField(fields[f], grid);
+    }
+}
+
+// Set one cell kind, returns cells changed (0 or 1)
+int EditMazeGridCell(MazeEditJournal *journal, MazeGrid *grid, Point cell, MazeCell kind)
+{
+    if (((unsigned int)cell.x >= (unsigned int)grid->width) || ((unsigned int)cell.y >= (unsigned int)grid->height)) return 0;
+
+    int index = cell.y*grid->width + cell.x;
+    unsigned char before = grid->cells[index];
+
+    if (before == (unsigned char)kind) return 0;
+
+    grid->cells[index] = (unsigned char)kind;
+    RecordEditCell(journal, index, before, (unsigned char)kind);
+
+    return 1;
+}
+
+// Set cells kind along a line (Bresenham), both end cells included, returns cells changed
+int EditMazeGridLine(MazeEditJournal *journal, MazeGrid *grid, Point start, Point end, MazeCell kind)
+{
+    int dx = abs(end.x - start.x);
+    int dy = -abs(end.y - start.y);
+    int stepX = (start.x < end.x)? 1 : -1;
+    int stepY = (start.y < end.y)? 1 : -1;
+    int error = dx + dy;
+    int changed = 0;
+
+    Point cell = start;
+
+    while (true)
+    {
+        changed += EditMazeGridCell(journal, grid, cell, kind);
+
+        if ((cell.x == end.x) && (cell.y == end.y)) break;
+
+        int error2 = 2*error;
+
+        if (error2 >= dy)
+        {
+            error += dy;
+            cell.x += stepX;
+        }
+
+        if (error2 <= dx)
+        {
+            error += dx;
+            cell.y += stepY;
+        }
+    }
+
+    return changed;
+}
+
+// Set cells kind in rectangle defined by two corner cells (any order), returns cells changed
+// NOTE: Rectangle is clamped to grid limits
+int EditMazeGridRectangle(MazeEditJournal *journal, MazeGrid *grid, Point start, Point end, MazeCell kind)
+{
+    int minX = (start.x < end.x)? start.x : end.x;
+    int minY = (start.y < end.y)? start.y : end.y;
+    int maxX = (start.x > end.x)? start.x : end.x;
+    int maxY = (start.y > end.y)? start.y : end.y;
+
+    if (minX < 0) minX = 0;
+    if (minY < 0) minY = 0;
+    if (maxX > (grid->width - 1)) maxX = grid->width - 1;
+    if (maxY > (grid->height - 1)) maxY = grid->height - 1;
+
+    int changed = 0;
+
+    for (int y = minY; y <= maxY; y++)
+    {
+        unsigned char *row = grid->cells + y*grid->width;
+
+        for (int x = minX; x <= maxX; x++)
+        {
+            if (row[x] == (unsigned char)kind) continue;
+
+            RecordEditCell(journal, y*grid->width + x, row[x], (unsigned char)kind);
+            row[x] = (unsigned char)kind;
+            changed++;
+        }
+    }
+
+    return changed;
+}
+
+// Set cells kind in region connected to seed cell with same kind as seed (4-connected), returns cells changed
+// NOTE: Scanline fill, every row span is filled at once and only span starts are pushed to stack
+int EditMazeGridFill(MazeEditJournal *journal, MazeGrid *grid, Point seed, MazeCell kind)
+{
+    if (((unsigned int)seed.x >= (unsigned int)grid->width) || ((unsigned int)seed.y >= (unsigned int)grid->height)) return 0;
+
+    int width = grid->width;
+    int height = grid->height;
+    unsigned char target = grid->cells[seed.y*width + seed.x];
+
+    if (target == (unsigned char)kind) return 0;
+
+    int stackCapacity = 256;
+    int stackCount = 0;
+    Point *stack = (Point *)malloc(stackCapacity*sizeof(Point));
+    int changed = 0;
+
+    stack[stackCount++] = seed;
+
+    while (stackCount > 0)
+    {
+        Point cell = stack[--stackCount];
+        unsigned char *row = grid->cells + cell.y*width;
+
+        if (row[cell.x] != target) continue;        // Already filled by another span
+
+        // Get full span of target cells in row
+        int left = cell.x;
+        int right = cell.x;
+
+        while ((left > 0) && (row[left - 1] == target)) left--;
+        while ((right < (width - 1)) && (row[right + 1] == target)) right++;
+
+        for (int x = left; x <= right; x++)
+        {
+            row[x] = (unsigned char)kind;
+            RecordEditCell(journal, cell.y*width + x, target, (unsigned char)kind);
+        }
+
+        changed += right - left + 1;
+
+        // Push first cell of every target span above and below filled span
+        for (int ny = cell.y - 1; ny <= cell.y + 1; ny += 2)
+        {
+            if ((ny < 0) || (ny >= height)) continue;
+
+            const unsigned char *nextRow = grid->cells + ny*width;
+            bool inSpan = false;
+
+            for (int x = left; x <= right; x++)
+            {
+                if (nextRow[x] != target) inSpan = false;
+                else if (!inSpan)
+                {
+                    if (stackCount == stackCapacity)
+                    {
+                        stackCapacity *= 2;
+                        stack = (Point *)realloc(stack, stackCapacity*sizeof(Point));
+                    }
+
+                    stack[stackCount++] = (Point){ x, ny };
+                    inSpan = true;
+                }
+            }
+        }
+    }
+
+    free(stack);
+
+    return changed;
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+// Record cell change, merged into last run if possible
+// NOTE: Runs already flushed are never extended, so every batch only contains new changes
+static void RecordEditCell(MazeEditJournal *journal, int index, unsigned char before, unsigned char after)
+{
+    if (journal->runCount > journal->flushedRun)
+    {
+        MazeEditRun *last = &journal->runs[journal->runCount - 1];
+
+        if (((last->index + last->length) == index) && (last->before == before) &&
+            (last->after == after) && (last->length < MAX_EDIT_RUN_LENGTH))
+        {
+            last->length++;
+            return;
+        }
+    }
+
+    if (journal->runCount == journal->runCapacity)
+    {
+        journal->runCapacity *= 2;
+        journal->runs = (MazeEditRun *)realloc(journal->runs, journal->runCapacity*sizeof(MazeEditRun));
+    }
+
+    journal->runs[journal->runCount++] = (MazeEditRun){ index, 1, before, after };
+}
+
+// Get batch for a range of runs
+static MazeEditBatch GetEditBatch(const MazeEditJournal *journal, int firstRun, int runCount, bool undo)
+{
+    MazeEditBatch batch = { journal->runs + firstRun, runCount, 0, undo };
+
+    for (int i = 0; i < runCount; i++) batch.cellCount += batch.runs[i].length;
+
+    return batch;
+}
+
+// Drop oldest entries until runs fit in budget
+// NOTE: Last entry is always kept, even if it does not fit in budget by itself
+static void DropOldestEditEntries(MazeEditJournal *journal)
+{
+    int dropEntries = 0;
+    int dropRuns = 0;
+
+    while (((journal->runCount - dropRuns) > journal->maxRuns) && (dropEntries < (journal->entryCount - 1)))
+    {
+        dropRuns += journal->entries[dropEntries].runCount;
+        dropEntries++;
+    }
+
+    if (dropEntries == 0) return;
+
+    memmove(journal->runs, journal->runs + dropRuns, (journal->runCount - dropRuns)*sizeof(MazeEditRun));
+    memmove(journal->entries, journal->entries + dropEntries, (journal->entryCount - dropEntries)*sizeof(MazeEditEntry));
+
+    journal->runCount -= dropRuns;
+    journal->entryCount -= dropEntries;
+    journal->doneCount -= dropEntries;
+    journal->flushedRun -= dropRuns;
+
+    for (int i = 0; i < journal->entryCount; i++) journal->entries[i].firstRun -= dropRuns;
+}
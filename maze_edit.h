@@ -0,0 +1,110 @@
+/*******************************************************************************************
+*
+*   maze_edit - Maze editor bulk tools and undo/redo journal
+*
+*   Editor tools (cell, line, rectangle, flood fill) modify grid cells directly and record
+*   every change in a journal, as runs of consecutive cells sharing previous and new kind,
+*   so large uniform edits only take a few bytes of history
+*
+*   Changes are returned in batches (MazeEditBatch), so any data derived from grid cells
+*   (items, distance fields, textures) can be updated once per batch, not once per cell:
+*   UpdateMazeEditBatch() updates texture dirty region and distance fields, incrementally
+*   with all batch cells at once, only batches over MAZE_EDIT_FIELD_CELLS recompute fields
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#ifndef MAZE_EDIT_H
+#define MAZE_EDIT_H
+
+#include "maze_grid.h"      // Required for: MazeGrid, MazeCell, Point
+#include "maze_path.h"      // Required for: MazeDistanceField
+#include "maze_render.h"    // Required for: MazeDirtyRegion
+
+#define MAZE_EDIT_JOURNAL_RUNS      262144      // Default journal budget in runs (8 bytes per run)
+#define MAZE_EDIT_FIELD_CELLS       4096        // Max cells changed in a batch with distance fields updated incrementally, bigger batches recompute them
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Maze editor tools
+typedef enum MazeEditTool {
+    MAZE_EDIT_BRUSH = 0,        // Cells painted while mouse button is held
+    MAZE_EDIT_LINE,             // Line from pressed cell to released cell
+    MAZE_EDIT_RECTANGLE,        // Filled rectangle from pressed cell to released cell
+    MAZE_EDIT_FILL,             // Flood fill of the region connected to pressed cell (4-connected)
+} MazeEditTool;
+
+// Run of consecutive grid cells (row-major) changed from the same kind to the same kind
+typedef struct MazeEditRun {
+    int index;                  // First cell index (y*width + x)
+    unsigned short length;      // Cells in run
+    unsigned char before;       // Cells kind before change (MazeCell)
+    unsigned char after;        // Cells kind after change (MazeCell)
+} MazeEditRun;
+
+// Journal entry, one undoable edit operation
+typedef struct MazeEditEntry {
+    int firstRun;               // First run of entry in journal runs
+    int runCount;               // Runs in entry
+} MazeEditEntry;
+
+// Batch of cell changes applied to grid, to update data derived from grid cells
+// NOTE: If undo is true, runs were reverted (cells changed from after to before kind),
+// runs must be processed in reverse order in that case
+typedef struct MazeEditBatch {
+    const MazeEditRun *runs;    // Runs applied (points to journal data, valid until next journal change)
+    int runCount;               // Runs applied
+    int cellCount;              // Cells changed
+    bool undo;                  // Runs were reverted
+} MazeEditBatch;
+
+// Maze edit journal, entries undone are kept to be redone until a new edit begins
+typedef struct MazeEditJournal {
+    MazeEditRun *runs;          // All entries runs, in order
+    int runCount;               // Runs recorded
+    int runCapacity;            // Runs allocated
+    int maxRuns;                // Runs budget, oldest entries are dropped to fit in it
+    MazeEditEntry *entries;     // Journal entries, in order
+    int entryCount;             // Entries recorded (undone entries included)
+    int entryCapacity;          // Entries allocated
+    int doneCount;              // Entries applied, next to be undone is doneCount - 1
+    int flushedRun;             // First run not returned in a batch yet
+    bool recording;             // An entry is being recorded
+    Point *fieldCells;          // Batch cells scratch for distance fields update (MAZE_EDIT_FIELD_CELLS)
+} MazeEditJournal;
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+MazeEditJournal LoadMazeEditJournal(int maxRuns);                       // Load edit journal, with a runs budget (0 for default)
+void UnloadMazeEditJournal(MazeEditJournal journal);                    // Unload edit journal from memory (RAM)
+void ClearMazeEditJournal(MazeEditJournal *journal);                    // Remove all entries, keeping memory
+
+void BeginMazeEdit(MazeEditJournal *journal);                           // Begin recording a new entry, entries undone are discarded
+MazeEditBatch FlushMazeEdit(MazeEditJournal *journal);                  // Get changes recorded since last flush, entry is kept open
+MazeEditBatch EndMazeEdit(MazeEditJournal *journal);                    // End recording entry, returns changes not flushed yet
+MazeEditBatch UndoMazeEdit(MazeEditJournal *journal, MazeGrid *grid);   // Revert last applied entry, returns reverted changes
+MazeEditBatch RedoMazeEdit(MazeEditJournal *journal, MazeGrid *grid);   // Apply again last undone entry, returns applied changes
+
+// Update data derived from batch cells: dirty region (if any) and distance fields, grid must be already changed
+// NOTE: Journal cells scratch is reused for distance fields update, no allocation per batch
+void UpdateMazeEditBatch(MazeEditJournal *journal, MazeEditBatch batch, MazeGrid grid, MazeDirtyRegion *dirty, MazeDistanceField **fields, int fieldCount);
+
+// Editor tools, cells are changed in grid and recorded in current entry, returns cells changed
+// NOTE: Must be called between BeginMazeEdit() and EndMazeEdit()
+int EditMazeGridCell(MazeEditJournal *journal, MazeGrid *grid, Point cell, MazeCell kind);
+int EditMazeGridLine(MazeEditJournal *journal, MazeGrid *grid, Point start, Point end, MazeCell kind);
+int EditMazeGridRectangle(MazeEditJournal *journal, MazeGrid *grid, Point start, Point end, MazeCell kind);
+int EditMazeGridFill(MazeEditJournal *journal, MazeGrid *grid, Point seed, MazeCell kind);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // MAZE_EDIT_H
@@ -0,0 +1,240 @@
+/*******************************************************************************************
+*
+*   maze_file - Binary maze level files, memory-mapped on load
+*
+*   NOTE: On Windows file data is read into memory (single read, no parsing),
+*   win32 mapping headers conflict with raylib names
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "maze_file.h"
+
+#include <stdio.h>          // Required for: FILE, fopen(), fwrite(), fread(), fclose(), rename(), remove()
+#include <stdlib.h>         // Required for: malloc(), free()
+#include <string.h>         // Required for: memcmp(), memcpy()
+
+#if !defined(_WIN32)
+    #include <fcntl.h>      // Required for: open()
+    #include <unistd.h>     // Required for: close()
+    #include <sys/mman.h>   // Required for: mmap(), munmap()
+    #include <sys/stat.h>   // Required for: fstat()
+#endif
+
+#define MAZE_FILE_CELLS_ALIGNMENT   64
+#define MAX_MAZE_FILE_PATH          512     // Max file name length on save (temporary file name)
+#define MAZE_FILE_CELLS_INVALID     0xfcfcfcfcfcfcfcfcULL   // Cells bits never set in valid cells (MAZE_CELL_KINDS = 4), 8 cells per word
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Declaration
+//----------------------------------------------------------------------------------
+static bool CheckMazeFileHeader(const MazeFileHeader *header, size_t dataSize);     // Check header values fit file data
+static bool CheckMazeFileLevel(const MazeFile *file);                               // Check level data is valid: cells kinds, start, end and items cells
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Load maze file (memory-mapped), grid.cells is NULL on failure
+MazeFile LoadMazeFile(const char *fileName)
+{
+    MazeFile file = { 0 };
+
+#if !defined(_WIN32)
+    int fd = open(fileName, O_RDONLY);
+    if (fd < 0) return file;
+
+    struct stat info = { 0 };
+
+    if ((fstat(fd, &info) == 0) && (info.st_size >= (off_t)sizeof(MazeFileHeader)))
+    {
+        // Private mapping: pages are only read when accessed, and copied on write
+        void *data = mmap(NULL, (size_t)info.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+
+        if (data != MAP_FAILED)
+        {
+            file.data = data;
+            file.dataSize = (size_t)info.st_size;
+            file.mapped = true;
+        }
+    }
+
+    close(fd);      // Mapping is kept after closing file
+#else
+    FILE *stream = fopen(fileName, "rb");
+    if (stream == NULL) return file;
+
+    fseek(stream, 0, SEEK_END);
+    long size = ftell(stream);
+    fseek(stream, 0, SEEK_SET);
+
+    if (size >= (long)sizeof(MazeFileHeader))
+    {
+        file.data = malloc((size_t)size);
+
+        if ((file.data != NULL) && (fread(file.data, 1, (size_t)size, stream) == (size_t)size)) file.dataSize = (size_t)size;
+        else
+        {
+            free(file.data);
+            file.data = NULL;
+        }
+    }
+
+    fclose(stream);
+#endif
+
+    if (file.data == NULL) return file;
+
+    const MazeFileHeader *header = (const MazeFileHeader *)file.data;
+
+    if (!CheckMazeFileHeader(header, file.dataSize))
+    {
+        UnloadMazeFile(file);
+        return (MazeFile){ 0 };
+    }
+
+    unsigned char *base = (unsigned char *)file.data;
+
+    file.grid = (MazeGrid){ header->width, header->height, base + header->cellsOffset };
+    file.startCell = header->startCell;
+    file.endCell = header->endCell;
+    file.itemCount = header->itemCount;
+    file.items = (const MazeItem *)(base + header->itemsOffset);
+
+    if (!CheckMazeFileLevel(&file))
+    {
+        UnloadMazeFile(file);
+        return (MazeFile){ 0 };
+    }
+
+    return file;
+}
+
+// Unload maze file data, grid is not valid any more
+void UnloadMazeFile(MazeFile file)
+{
+    if (file.data == NULL) return;
+
+#if !defined(_WIN32)
+    if (file.mapped)
+    {
+        munmap(file.data, file.dataSize);
+        return;
+    }
+#endif
+
+    free(file.data);
+}
+
+// Save maze level to file, returns true on success
+// NOTE: Level is written to a temporary file renamed over fileName once complete: grid can point
+// to a mapping of fileName (level loaded from it), truncating that file would invalidate the mapping
+bool SaveMazeFile(const char *fileName, MazeGrid grid, Point startCell, Point endCell, MazeItems items)
+{
+    if (grid.cells == NULL) return false;
+
+    char tempName[MAX_MAZE_FILE_PATH] = { 0 };
+    int nameLength = snprintf(tempName, MAX_MAZE_FILE_PATH, "%s.tmp", fileName);
+    if ((nameLength < 0) || (nameLength >= MAX_MAZE_FILE_PATH)) return false;
+
+    FILE *stream = fopen(tempName, "wb");
+    if (stream == NULL) return false;
+
+    MazeFileHeader header = { 0 };
+    memcpy(header.id, "MAZE", 4);
+    header.version = MAZE_FILE_VERSION;
+    header.width = grid.width;
+    header.height = grid.height;
+    header.startCell = startCell;
+    header.endCell = endCell;
+    header.itemCount = items.count;
+    header.itemsOffset = sizeof(MazeFileHeader);
+
+    unsigned long long itemsEnd = header.itemsOffset + (unsigned long long)items.count*sizeof(MazeItem);
+    header.cellsOffset = (itemsEnd + MAZE_FILE_CELLS_ALIGNMENT - 1)/MAZE_FILE_CELLS_ALIGNMENT*MAZE_FILE_CELLS_ALIGNMENT;
+
+    bool success = (fwrite(&header, sizeof(MazeFileHeader), 1, stream) == 1);
+
+    // Items table, written in store slots order
+    for (int i = 0; success && (i < items.capacity); i++)
+    {
+        if (items.slots[i].cell.x != MAZE_ITEM_EMPTY_SLOT) success = (fwrite(&items.slots[i], sizeof(MazeItem), 1, stream) == 1);
+    }
+
+    // Padding up to cells alignment
+    static const unsigned char padding[MAZE_FILE_CELLS_ALIGNMENT] = { 0 };
+    size_t paddingSize = (size_t)(header.cellsOffset - itemsEnd);
+
+    if (success && (paddingSize > 0)) success = (fwrite(padding, 1, paddingSize, stream) == paddingSize);
+
+    size_t cellCount = (size_t)grid.width*grid.height;
+    if (success) success = (fwrite(grid.cells, 1, cellCount, stream) == cellCount);
+
+    if (fclose(stream) != 0) success = false;
+
+#if defined(_WIN32)
+    // NOTE: rename() does not replace existing files on Windows, file data is never mapped there
+    if (success) remove(fileName);
+#endif
+    // Current mappings keep previous file data, replaced file is only released once unmapped
+    if (success) success = (rename(tempName, fileName) == 0);
+    if (!success) remove(tempName);
+
+    return success;
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+// Check header values fit file data
+// NOTE: Level data (cells, items) is checked by CheckMazeFileLevel(), once header is valid
+static bool CheckMazeFileHeader(const MazeFileHeader *header, size_t dataSize)
+{
+    if ((memcmp(header->id, "MAZE", 4) != 0) || (header->version != MAZE_FILE_VERSION)) return false;
+    if ((header->width <= 0) || (header->height <= 0) || (header->itemCount < 0)) return false;
+
+    unsigned long long cellsSize = (unsigned long long)header->width*(unsigned long long)header->height;
+    unsigned long long itemsSize = (unsigned long long)header->itemCount*sizeof(MazeItem);
+
+    if ((header->itemsOffset < sizeof(MazeFileHeader)) || ((header->itemsOffset%sizeof(int)) != 0)) return false;
+    if ((header->itemsOffset > dataSize) || (itemsSize > (dataSize - header->itemsOffset))) return false;
+    if ((header->cellsOffset > dataSize) || (cellsSize > (dataSize - header->cellsOffset))) return false;
+
+    return true;
+}
+
+// Check level data is valid: all cells are a MazeCell kind, start and end cells are walkable
+// and items cells are in grid, so level can be used as stored
+// NOTE: Cells are checked 8 at a time (one word), valid cells never set bits over MAZE_CELL_KINDS - 1
+static bool CheckMazeFileLevel(const MazeFile *file)
+{
+    MazeGrid grid = file->grid;
+
+    if ((GetMazeCell(grid, file->startCell.x, file->startCell.y) == MAZE_CELL_WALL) ||
+        (GetMazeCell(grid, file->endCell.x, file->endCell.y) == MAZE_CELL_WALL)) return false;   // Out of grid cells are walls
+
+    for (int i = 0; i < file->itemCount; i++)
+    {
+        Point cell = file->items[i].cell;
+
+        if (((unsigned int)cell.x >= (unsigned int)grid.width) || ((unsigned int)cell.y >= (unsigned int)grid.height)) return false;
+    }
+
+    size_t cellCount = (size_t)grid.width*grid.height;
+    size_t i = 0;
+
+    for (; (i + 8) <= cellCount; i += 8)
+    {
+        unsigned long long cells = 0;
+        memcpy(&cells, grid.cells + i, 8);
+
+        if ((cells & MAZE_FILE_CELLS_INVALID) != 0) return false;
+    }
+
+    for (; i < cellCount; i++)
+    {
+        if (grid.cells[i] >= MAZE_CELL_KINDS) return false;
+    }
+
+    return true;
+}
@@ -0,0 +1,78 @@
+/*******************************************************************************************
+*
+*   maze_file - Binary maze level files, memory-mapped on load
+*
+*   File layout (native byte order, little-endian on all supported platforms):
+*     - MazeFileHeader
+*     - Items table: itemCount MazeItem records, at itemsOffset
+*     - Cells: width*height bytes (MazeCell), row-major, at cellsOffset (64 bytes aligned)
+*
+*   Cells are stored with the same layout than MazeGrid, so the loaded grid points
+*   directly to file data: no per-cell parsing, only a validation pass (8 cells per word).
+*   File is mapped copy-on-write, grid can be edited without modifying the file, and saved
+*   back to the same file (written to a temporary file, then renamed over it)
+*
+*   Files are rejected on load if header does not fit file data, any cell is not a MazeCell
+*   kind, start or end cells are out of grid or walls, or any item cell is out of grid
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#ifndef MAZE_FILE_H
+#define MAZE_FILE_H
+
+#include "maze_grid.h"      // Required for: MazeGrid, Point
+#include "maze_items.h"     // Required for: MazeItems, MazeItem
+
+#include <stddef.h>         // Required for: size_t
+
+#define MAZE_FILE_VERSION   1
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Maze file header
+typedef struct MazeFileHeader {
+    char id[4];                     // File identifier: "MAZE"
+    unsigned int version;           // File format version: MAZE_FILE_VERSION
+    int width;                      // Grid width in cells
+    int height;                     // Grid height in cells
+    Point startCell;                // Player start cell
+    Point endCell;                  // Maze exit cell
+    int itemCount;                  // Items table records
+    unsigned int reserved;
+    unsigned long long itemsOffset; // Items table offset, from file start
+    unsigned long long cellsOffset; // Cells offset, from file start
+} MazeFileHeader;
+
+// Maze file, loaded
+typedef struct MazeFile {
+    MazeGrid grid;                  // Level cells, pointing to file data
+    Point startCell;                // Player start cell
+    Point endCell;                  // Maze exit cell
+    int itemCount;                  // Items count
+    const MazeItem *items;          // Items table, pointing to file data
+    void *data;                     // File data (mapped or loaded)
+    size_t dataSize;                // File data size in bytes
+    bool mapped;                    // File data is memory-mapped
+} MazeFile;
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+MazeFile LoadMazeFile(const char *fileName);                                // Load maze file (memory-mapped), grid.cells is NULL on failure
+void UnloadMazeFile(MazeFile file);                                         // Unload maze file data, grid is not valid any more
+
+// Save maze level to file, returns true on success
+bool SaveMazeFile(const char *fileName, MazeGrid grid, Point startCell, Point endCell, MazeItems items);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // MAZE_FILE_H
@@ -12,8 +12,30 @@
 ********************************************************************************************/
 
 #include "raylib.h"
+#include "rlgl.h"       // Required for: rlSetTexture(), rlBegin(), rlVertex2f(), rlTextureParameters()...
 
-#include <stdlib.h>     // Required for: malloc(), free()
+#include "maze_grid.h"      // Required for: MazeGrid, GenMazeGrid(), GetMazeCell(), SetMazeCell()...
+#include "maze_path.h"      // Required for: MazeDistanceField, LoadMazeDistanceField(), GetMazeDistance()...
+#include "maze_collision.h" // Required for: MoveMazeBox()
+#include "maze_items.h"     // Required for: MazeItems, AddMazeItem(), RemoveMazeItem()
+#include "maze_world.h"     // Required for: MazeWorld, LoadMazeWorld(), UpdateMazeWorldView()
+#include "maze_file.h"      // Required for: MazeFile, LoadMazeFile(), SaveMazeFile()
+#include "maze_assets.h"    // Required for: AddMazeAsset(), RequestMazeAsset(), UpdateMazeAssets()...
+#include "maze_profiler.h"  // Required for: BeginProfileScope(), EndProfileScope(), GetMazeTime()...
+#include "maze_replay.h"    // Required for: MazeReplay, LoadMazeReplay(), SaveMazeReplay()...
+#include "maze_edit.h"      // Required for: MazeEditJournal, EditMazeGridRectangle(), UndoMazeEdit()...
+#include "maze_arena.h"     // Required for: MazeArena, LoadMazeArena(), ResetMazeArena()
+#include "maze_audio.h"     // Required for: InitMazeAudio(), PlayMazeMusic(), PauseMazeMusic()...
+#include "maze_agents.h"    // Required for: MazeAgents, LoadMazeAgents(), AddMazeAgent(), UpdateMazeAgents()
+#include "maze_visibility.h" // Required for: MazeVisibility, UpdateMazeVisibility(), IsMazeCellVisible()...
+#include "maze_stats.h"     // Required for: MazeStats, GetMazeStats(), DrawMazeStats()
+#include "maze_render.h"    // Required for: DrawMazeTiles(), LoadMazeTexture(), UpdateMazeTexture()...
+#include "maze_jobs.h"      // Required for: InitMazeJobs(), CloseMazeJobs()
+
+#include <stdio.h>      // Required for: printf(), fprintf()
+#include <stdlib.h>     // Required for: malloc(), free(), abs()
+#include <string.h>     // Required for: strcmp(), memcpy()
+#include <math.h>       // Required for: floorf(), fminf(), fmaxf(), fabsf(), powf()
 
 #define MAZE_WIDTH          64
 #define MAZE_HEIGHT         64
@@ -21,110 +43,335 @@
 #define SPACING_COLS        4
 #define POINT_CHANCE        0.75f
 #define MAZE_SCALE          10.0f
-#define MAZE_SCALE          10.0f
+#define MAZE_SEED           67218
+#define MAZE_LEVEL_FILE     "level.maze"    // Level file saved/loaded by editor
+
+#define MAZE_ITEM_VALUE     50          // Score added on item pickup
+
+#define CAMERA_MAX_ZOOM     20.0f       // Max camera zoom, min zoom fits whole maze on screen
+#define CAMERA_ZOOM_STEP    1.1f        // Camera zoom factor per mouse wheel step
+#define MAZE_LOD_CELL_PIXELS 4.0f       // Cells smaller than this on screen (pixels) are drawn from maze texture, not tiles
 
-#define MAX_MAZE_ITEMS      16
+#define MINIMAP_SIZE        200         // Minimap max size on screen, in pixels (maze aspect ratio is kept)
+
+#define FOG_VIEW_RADIUS     12          // Player view radius in game mode, in cells
+
+#define WORLD_VIEW_CHUNKS   3           // Chunked world view size, in chunks (centered on player chunk)
+#define WORLD_MAX_CHUNKS    25          // Chunked world memory budget, in chunks
 
 #define PLAYER_WIDTH        7
 #define PLAYER_HEIGHT       7
-#define PLAYER_SPEED        3
+#define PLAYER_SPEED        3.0f        // Pixels moved per simulation tick
+
+#define AGENT_COUNT         10000       // Chasers spawned in level when game mode begins
+#define AGENT_SIZE          5.0f        // Chaser box size, in pixels
+#define AGENT_SPEED         1.5f        // Chaser max pixels moved per simulation tick (slower than player)
+#define AGENT_SPAWN_DISTANCE 24         // Min steps from player cell to chasers spawn cells
+#define AGENT_RANDOM_STREAM 0xa6e7      // Random stream for chasers spawn, independent from maze generation
+
+#define SIM_TICK_RATE       60          // Simulation ticks per second, independent of rendering
+#define SIM_TIMESTEP        (1.0f/SIM_TICK_RATE)
+#define SIM_MAX_FRAME_TIME  0.25f       // Max frame time simulated, avoids spiral of death after long stalls
 
-// Declare new data type: Point
-typedef struct Point {
-    int x;
-    int y;
-} Point;
+// Game input actions, stored as flags
+typedef enum GameAction {
+    ACTION_MOVE_UP      = 1 << 0,
+    ACTION_MOVE_DOWN    = 1 << 1,
+    ACTION_MOVE_LEFT    = 1 << 2,
+    ACTION_MOVE_RIGHT   = 1 << 3,
+    ACTION_TOGGLE_MODE  = 1 << 4,
+    ACTION_BIOME_1      = 1 << 5,
+    ACTION_BIOME_2      = 1 << 6,
+    ACTION_BIOME_3      = 1 << 7,
+    ACTION_BIOME_4      = 1 << 8,
+    ACTION_EDIT_EXIT    = 1 << 9,       // Modifier for wall edit: place exit instead
+    ACTION_EDIT_FLOOR   = 1 << 10,
+    ACTION_EDIT_WALL    = 1 << 11,
+    ACTION_EDIT_ITEM    = 1 << 12,
+    ACTION_TOGGLE_WORLD = 1 << 13,
+    ACTION_SAVE_LEVEL   = 1 << 14,
+    ACTION_LOAD_LEVEL   = 1 << 15,
+    ACTION_TOOL_BRUSH   = 1 << 16,
+    ACTION_TOOL_LINE    = 1 << 17,
+    ACTION_TOOL_RECTANGLE = 1 << 18,
+    ACTION_TOOL_FILL    = 1 << 19,
+    ACTION_UNDO         = 1 << 20,
+    ACTION_REDO         = 1 << 21,
+} GameAction;
 
-// Generate procedural maze image, using grid-based algorithm
+// Profiled game phases, registered in this order so values are the profiler scope ids
+typedef enum GameProfileScope {
+    PROFILE_INPUT = 0,
+    PROFILE_MOVEMENT,           // Player movement and collision
+    PROFILE_PICKUP,             // Items pickup and exit check
+    PROFILE_EDIT,               // Editor cells edit
+    PROFILE_TEXTURE_UPLOAD,     // Maze texture and assets upload
+    PROFILE_TILE_DRAW,          // Maze tiles batching (CPU side)
+    PROFILE_UI_DRAW,
+    PROFILE_MUSIC,
+    PROFILE_AGENTS,             // Chasers flow field and movement
+    PROFILE_AGENT_DRAW,         // Chasers sprites batching (CPU side)
+    PROFILE_VISIBILITY,         // Player field of view (fog of war)
+    PROFILE_ANALYTICS,          // Maze statistics (only computed while shown)
+} GameProfileScope;
+
+// Profiled game counters, registered in this order so values are the profiler counter ids
+typedef enum GameProfileCounter {
+    PROFILE_TILE_BATCHES = 0,   // Tile batches sent to GPU (draw calls issued by tiles)
+    PROFILE_TEXTURE_UPLOADS,    // Maze texture updates and reallocations
+    PROFILE_AGENT_BATCHES,      // Chasers sprite batches sent to GPU
+} GameProfileCounter;
+
+// Game input, sampled once per frame and consumed by simulation ticks
+typedef struct GameInput {
+    unsigned int actionsDown;       // Actions held down (GameAction flags)
+    unsigned int actionsPressed;    // Actions pressed since last simulation tick (GameAction flags)
+    Vector2 mousePosition;          // Mouse position in screen coordinates
+} GameInput;
+
+// Maze level data, all kept in sync on every cell edit
+// NOTE: Level grid (if generated) and distance fields are allocated from level arena,
+// reset on every level change, so level restarts cost no heap allocations
+typedef struct MazeLevel {
+    MazeArena arena;                // Level memory, grows only if a bigger level is loaded
+    MazeGrid grid;                  // Maze cells
+    MazeFile file;                  // Level file, grid cells point to its data if loaded from file
+    MazeDirtyRegion dirty;          // Cells pending to be updated in texture
+    MazeDistanceField exitField;    // Steps to end cell, for every cell
+    MazeDistanceField startField;   // Steps to start cell, for every cell
+    MazeDistanceField chaseField;   // Steps to player cell, for every cell (chasers flow field)
+    MazeVisibility visibility;      // Cells visible from player cell and cells explored (fog of war)
+    MazeDirtyRegion fogDirty;       // Cells pending to be updated in fog texture
+} MazeLevel;
+
+// Game state, only modified by simulation ticks
+typedef struct GameState {
+    int currentMode;                // 0-Game, 1-Editor, 2-Win screen
+    MazeLevel level;
+    MazeWorld world;                // Chunked streaming world, explored in world mode
+    bool worldMode;                 // Player moving in chunked world instead of level (game mode only)
+    Point startCell;
+    Point endCell;
+    Vector2 mazeCenter;             // Maze drawing center (screen center), position follows level size
+    Vector2 mazePosition;           // Maze drawing position (editor mode)
+    Rectangle player;
+    Vector2 previousPlayer;         // Player position on previous tick, for interpolated rendering
+    MazeItems items;                // Maze items, by cell
+    MazeAgents agents;              // Chasers following player in level (game mode only)
+    MazeEditJournal journal;        // Editor changes, for undo/redo
+    MazeEditTool editTool;          // Editor tool selected
+    bool editActive;                // Editor tool in use (mouse button held since edit began)
+    MazeCell editKind;              // Cell kind set by current edit
+    Point editStart;                // Cell where current edit began
+    Point editCursor;               // Cell under mouse for current edit, clamped to maze
+    int currentBiome;
+    int score;
+    int currentFrame;               // Character animation frame
+    int currentRow;                 // Character animation row (direction)
+    float frameTime;                // Time on current animation frame
+} GameState;
+
+// Fixed timestep simulation clock: frame time is accumulated and consumed in SIM_TIMESTEP ticks
+typedef struct GameClock {
+    float accumulator;              // Frame time not simulated yet
+    unsigned int pendingPressed;    // Actions pressed, waiting for a simulation tick
+} GameClock;
+
+// Draw agents visible by camera, interpolated between their two last positions, all sprites sent to GPU as a single batch
 // NOTE: Functions defined as static are internal to the module
-static Image GenImageMaze(int width, int height, int spacingRows, int spacingCols, float pointChance);
+// NOTE: If visibility is provided, agents in cells out of view are skipped
+static void DrawMazeAgents(MazeAgents agents, Texture texSprite, Vector2 frameSize, Vector2 position, float alpha, Camera2D camera, Color tint, const MazeVisibility *visibility);
+
+// Edit maze cell kind, registering changed cell in dirty region and updating distance fields
+static void EditMazeCell(MazeLevel *level, Point cell, MazeCell kind);
+
+// Update level data derived from cells (items, distance fields, dirty region) for a batch of edited cells
+static void ApplyMazeEditBatch(MazeLevel *level, MazeItems *items, MazeEditJournal *journal, MazeEditBatch batch);
+
+// Load fog texture (one pixel per cell), all cells unexplored
+static Texture LoadFogTexture(int width, int height);
+
+// Update fog texture with dirty region cells only: unexplored cells opaque, explored cells shaded, visible cells clear
+static void UpdateFogTexture(Texture texFog, MazeVisibility visibility, MazeDirtyRegion *region);
+
+// Draw maze minimap in screen space from maze texture and fog texture, with player marker and camera view area (in cells)
+static void DrawMazeMinimap(Texture texMaze, Texture texFog, Rectangle bounds, Vector2 playerCell, Rectangle viewCells);
+
+static GameInput PollGameInput(void);                                       // Sample game input from keyboard and mouse
+static void ResetGameLevel(GameState *state);                               // Generate a new level, reseting player and items
+static bool LoadGameLevel(GameState *state, const char *fileName);          // Load level from file, reseting player and items
+static void UnloadGameLevel(MazeLevel *level);                              // Unload level grid and distance fields
+static void ReserveGameLevel(MazeLevel *level, int width, int height);      // Make sure level arena fits a level of given size
+static void CenterGameLevel(GameState *state);                              // Set maze drawing position, level centered on maze center
+static void SetPlayerCell(GameState *state, Vector2 origin, Point cell);    // Place player at cell, for maze drawn at origin
+static void SpawnGameAgents(GameState *state);                              // Spawn level chasers on random cells, far enough from player
+static void UpdateGameVisibility(MazeLevel *level, Point cell);             // Update visible cells from player cell, registering changed cells in fog dirty region
+static void UpdateGame(GameState *state, GameInput input, float deltaTime); // Update game state, one simulation tick
+
+static void InitGameState(GameState *state, int screenWidth, int screenHeight);     // Init game state, level generated and player at start cell
+static void UnloadGameState(GameState *state);                                      // Unload game state data (level, items, world)
+static int UpdateGameFrame(GameState *state, GameClock *clock, GameInput input, float frameTime);  // Run simulation ticks for frame time, returns ticks run
+static unsigned long long GetGameStateHash(const GameState *state);                 // Get game state hash (FNV-1a), for replays validation
+static int RunHeadlessReplay(MazeReplay replay, int screenWidth, int screenHeight); // Replay recorded input with no window, GPU or audio device
+static void PrintReplayReport(int frames, int ticks, double elapsed, unsigned long long hash);  // Print replay timing and state hash
 
 //----------------------------------------------------------------------------------
 // Main entry point
 //----------------------------------------------------------------------------------
-int main(void)
+int main(int argc, char *argv[])
 {
     // Initialization
     //---------------------------------------------------------
     const int screenWidth = 1280;
     const int screenHeight = 720;
 
+    // Command line options: input recording and replay
+    //   --record <file>     Record session input to file, saved on exit
+    //   --replay <file>     Replay input from file, as fast as possible, reporting timing and state hash
+    //   --headless          Replay with no window, GPU or audio device (requires --replay)
+    const char *recordFileName = NULL;
+    const char *replayFileName = NULL;
+    bool headless = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "--record") == 0) && ((i + 1) < argc)) recordFileName = argv[++i];
+        else if ((strcmp(argv[i], "--replay") == 0) && ((i + 1) < argc)) replayFileName = argv[++i];
+        else if (strcmp(argv[i], "--headless") == 0) headless = true;
+        else
+        {
+            fprintf(stderr, "USAGE: %s [--record file] [--replay file [--headless]]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    MazeReplay replay = { 0 };
+    MazeReplay record = { 0 };
+    int replayFrame = 0;
+
+    if (replayFileName != NULL)
+    {
+        replay = LoadMazeReplay(replayFileName);
+
+        if (replay.frames == NULL)
+        {
+            fprintf(stderr, "Replay file could not be loaded: %s\n", replayFileName);
+            return 1;
+        }
+    }
+
+    if (headless)
+    {
+        if (replay.frames == NULL)
+        {
+            fprintf(stderr, "Headless mode requires a replay file (--replay)\n");
+            return 1;
+        }
+
+        InitMazeJobs(0);
+        int result = RunHeadlessReplay(replay, screenWidth, screenHeight);
+        CloseMazeJobs();
+        UnloadMazeReplay(replay);
+
+        return result;
+    }
+
+    // NOTE: Replays run as fast as possible, not synced to monitor
+    if (replay.frames == NULL) SetConfigFlags(FLAG_VSYNC_HINT);    // Rendering synced to monitor, simulation runs at SIM_TICK_RATE
     InitWindow(screenWidth, screenHeight, "Delivery04 - maze game");
     
     InitAudioDevice();              // Initialize audio device
+    InitMazeAudio();                // Initialize audio thread, music streamed independently of frames
+    InitMazeAssets();               // Initialize assets manager, assets decoded by worker threads
+    InitMazeJobs(0);                // Initialize jobs pool, workers kept waiting for per-frame parallel jobs
 
-    // Current application mode
-    int currentMode = 1;    // 0-Game, 1-Editor
-
-    // Random seed defines the random numbers generation,
-    // always the same if using the same seed
-    SetRandomSeed(67218);
-
-    // Generate maze image using the grid-based generator
-    // TODO: [1p] Implement GenImageMaze() function with required parameters
-    Image imMaze = GenImageMaze(MAZE_WIDTH, MAZE_HEIGHT, SPACING_ROWS, SPACING_COLS, POINT_CHANCE);
+    // Initialize profiler, scopes and counters registered in enums order
+    InitMazeProfiler();
+    const char *profileScopeNames[] = { "input", "movement", "pickup", "edit", "texture_upload", "tile_draw", "ui_draw", "music", "agents", "agent_draw", "visibility", "analytics" };
+    const char *profileCounterNames[] = { "tile_batches", "texture_uploads", "agent_batches" };
+    for (int i = 0; i < (int)(sizeof(profileScopeNames)/sizeof(profileScopeNames[0])); i++) AddProfileScope(profileScopeNames[i]);
+    for (int i = 0; i < (int)(sizeof(profileCounterNames)/sizeof(profileCounterNames[0])); i++) AddProfileCounter(profileCounterNames[i]);
+    bool showProfiler = false;      // Profiler overlay, toggled with F3
 
-    // Load a texture to be drawn on screen from our image data
-    // WARNING: If imMaze pixel data is modified, texMaze needs to be re-loaded
-    Texture texMaze = LoadTextureFromImage(imMaze);
+    // Maze statistics, recomputed for every frame level cells changed while shown
+    MazeStats stats = { 0 };
+    bool showStats = false;         // Statistics overlay, toggled with F4
+    bool statsOutdated = true;
 
-    // Player start-position and end-position initialization
-    Point startCell = { 1, 1 };
-    Point endCell = { imMaze.width - 2, imMaze.height - 2 };
+    // Generate maze grid using the grid-based generator, player placed at start cell
+    GameState state = { 0 };
+    InitGameState(&state, screenWidth, screenHeight);
 
-    // Maze drawing position (editor mode)
-    Vector2 mazePosition = {
-        GetScreenWidth()/2 - texMaze.width*MAZE_SCALE/2,
-        GetScreenHeight()/2 - texMaze.height*MAZE_SCALE/2
-    };
+    // Load a texture to be drawn on screen, from an image generated from grid data
+    // WARNING: If level.grid cells are modified, changed cells must be set with EditMazeCell()
+    // or applied with ApplyMazeEditBatch() (editor tools),
+    // texMaze is only updated with the modified region once per frame
+    // NOTE: Maze texture is also the maze level of detail, drawn instead of tiles when zoomed out
+    Texture texMaze = LoadMazeTexture(state.level.grid);
+    bool mipmapsOutdated = false;   // texMaze mipmaps not generated since last update, only required when drawn minified
+    state.level.dirty.dirty = false;
 
-    // Define player position and size
-    Rectangle player = { mazePosition.x + startCell.x * MAZE_SCALE + 2, mazePosition.y + startCell.y * MAZE_SCALE + 2, PLAYER_WIDTH, PLAYER_HEIGHT };
+    // Fog of war texture (one pixel per cell), drawn over maze texture when tiles are not drawn (zoomed out, minimap)
+    // NOTE: Only cells around previous and current player view are updated when player enters a new cell
+    Texture texFog = LoadFogTexture(state.level.grid.width, state.level.grid.height);
 
     // Camera 2D for 2d gameplay mode
     // TODO: [2p] Initialize camera parameters as required
     Camera2D camera2d = { 0 };
-    camera2d.target = (Vector2){ player.x + 2, player.y + 2 };
+    camera2d.target = (Vector2){ state.player.x + 2, state.player.y + 2 };
     camera2d.offset = (Vector2){ screenWidth/2.0f, screenHeight/2.0f };
     camera2d.rotation = 0.0f;
     camera2d.zoom = 10.0f;
 
-    // Mouse selected cell for maze editing
-    // Point selectedCell = { 0 };
-
-    // Maze items position and state
-    Point mazeItems[MAX_MAZE_ITEMS] = { 0 };
-    int countItems = 0;
-    
     // Define textures to be used as our "biomes"
-    Texture texBiomes[4] = { 0 };
-    texBiomes[0] = LoadTexture("resources/maze_atlas01.png");
-    texBiomes[1] = LoadTexture("resources/maze_atlas02.png");
-    texBiomes[2] = LoadTexture("resources/maze_atlas03.png");
-    texBiomes[3] = LoadTexture("resources/maze_atlas04.png");
-    Texture2D spriteSheet = LoadTexture("resources/Character.png");
-    Music music = LoadMusicStream("resources/retro_beat.mp3");
-    
-    PlayMusicStream(music);
-    float timePlayed = 0.0f;        // Time played normalized [0.0f..1.0f]
+    // NOTE: Biomes are only registered, atlases are loaded on demand when selected
+    int biomeAssets[4] = { 0 };
+    for (int i = 0; i < 4; i++) biomeAssets[i] = AddMazeAsset(MAZE_ASSET_TEXTURE, TextFormat("resources/maze_atlas%02i.png", i + 1));
+    int spriteAsset = AddMazeAsset(MAZE_ASSET_TEXTURE, "resources/Character.png");
+    int musicAsset = AddMazeAsset(MAZE_ASSET_MUSIC, "resources/retro_beat.mp3");
+
+    RequestMazeAsset(biomeAssets[state.currentBiome]);
+    RequestMazeAsset(spriteAsset);
+    RequestMazeAsset(musicAsset);
+
+    // Loading frame, drawn while required assets are decoded and uploaded
+    while (!WindowShouldClose() && (GetMazeAssetsProgress() < 1.0f))
+    {
+        UpdateMazeAssets();
+
+        BeginDrawing();
+
+            ClearBackground(RAYWHITE);
+
+            DrawText("LOADING...", screenWidth/2 - MeasureText("LOADING...", 40)/2, screenHeight/2 - 60, 40, DARKGRAY);
+            DrawRectangle(screenWidth/4, screenHeight/2, (int)(screenWidth/2*GetMazeAssetsProgress()), 20, BLUE);
+            DrawRectangleLines(screenWidth/4, screenHeight/2, screenWidth/2, 20, DARKGRAY);
+
+        EndDrawing();
+    }
 
-    // TODO: Load additional textures for different biomes
-    int currentBiome = 0;
+    Texture2D spriteSheet = GetMazeAssetTexture(spriteAsset);
+    Music music = GetMazeAssetMusic(musicAsset);
+    int drawnBiome = state.currentBiome;    // Biome atlas drawn, kept until selected biome is loaded
+
+    PlayMazeMusic(music);
+    float timePlayed = 0.0f;        // Time played normalized [0.0f..1.0f]
+    bool musicPaused = false;       // Music paused, toggled with M
 
     // TODO: Define all variables required for game UI elements (sprites, fonts...)
-    int score = 0;
     Rectangle deadScreen = {screenWidth / 4, screenHeight / 4, screenWidth / 2, screenHeight / 2};
 
     // Character frames
     int frameWidth = 48;
     int frameHeight = 96;
-    int currentFrame = 0;
-    int currentRow = 0;
-    float frameTime = 0.1f;
 
     Rectangle frameRec = {0, 0, frameWidth, frameHeight};
 
-    SetTargetFPS(60);       // Set our game to run at 60 frames-per-second
+    // Fixed timestep simulation: frame time is accumulated and consumed in SIM_TIMESTEP ticks,
+    // rendering interpolates between the two last simulated states
+    GameClock clock = { 0 };
+    int replayTicks = 0;
+    double replayStartTime = GetMazeTime();
     //--------------------------------------------------------------------------------------
 
     // Main game loop
@@ -132,302 +379,132 @@ int main(void)
     {
         // Update
         //----------------------------------------------------------------------------------
-        // Select current mode as desired
-        if (IsKeyPressed(KEY_SPACE)) //currentMode = !currentMode; // Toggle mode: 0-Game, 1-Editor
+        BeginProfileFrame();
+
+        // Game input and frame time, read from replay if replaying
+        BeginProfileScope(PROFILE_INPUT);
+        GameInput input = { 0 };
+        float frameTime = GetFrameTime();
+
+        if (replay.frames != NULL)
         {
-            if (currentMode == 0)
-            {
-                currentMode = 1;
-            }
-            else if (currentMode == 1)
-            {
-                currentMode = 0;
-            }
-            else if (currentMode == 2)
-            {
-                currentMode = 1;
-                SetRandomSeed(67218);
-                imMaze = GenImageMaze(MAZE_WIDTH, MAZE_HEIGHT, SPACING_ROWS, SPACING_COLS, POINT_CHANCE);
-                
-                for (int i = 0; i < MAX_MAZE_ITEMS; i++)
-                {
-                    mazeItems[i] = (Point){0};
-                }
-                
-                countItems = 0;
-                
-                player.x = mazePosition.x + startCell.x * MAZE_SCALE + 2;
-                player.y = mazePosition.y + startCell.y * MAZE_SCALE + 2;
-                score = 0;
-            }
+            if (replayFrame >= replay.frameCount) break;
+
+            MazeReplayFrame frame = replay.frames[replayFrame++];
+            input = (GameInput){ frame.actionsDown, frame.actionsPressed, frame.mousePosition };
+            frameTime = frame.frameTime;
         }
+        else input = PollGameInput();
 
-        if (currentMode == 0) // Game mode
+        if (frameTime > SIM_MAX_FRAME_TIME) frameTime = SIM_MAX_FRAME_TIME;
+
+        if (recordFileName != NULL) AddMazeReplayFrame(&record, (MazeReplayFrame){ frameTime, input.actionsDown, input.actionsPressed, input.mousePosition });
+
+        if (IsKeyPressed(KEY_F3)) showProfiler = !showProfiler;
+        if (IsKeyPressed(KEY_F4))
         {
-            // TODO: [2p] Player 2D movement from predefined Start-point to End-point
-            // Implement maze 2D player movement logic (cursors || WASD)
-            // Use imMaze pixel information to check collisions
-            // Detect if current playerCell == endCell to finish game
-            
-            if (IsKeyDown(KEY_UP) || IsKeyDown(KEY_W))
-            {
-                if (!ColorIsEqual(GetImageColor(imMaze, (player.x - mazePosition.x) / MAZE_SCALE, ((player.y - PLAYER_SPEED) - mazePosition.y) / MAZE_SCALE), WHITE) && !ColorIsEqual(GetImageColor(imMaze, (player.x + PLAYER_WIDTH - mazePosition.x) / MAZE_SCALE, ((player.y - PLAYER_SPEED) - mazePosition.y) / MAZE_SCALE), WHITE))
-                {
-                    if ((player.x - mazePosition.x) / MAZE_SCALE > 0 && (player.y - mazePosition.y) / MAZE_SCALE > 0)
-                    {
-                        player.y -= PLAYER_SPEED;
-                        currentRow = 3; 
-                        
-                    }
-                }
-            } 
-            else if (IsKeyDown(KEY_DOWN) || IsKeyDown(KEY_S))
-            {
-                if (!ColorIsEqual(GetImageColor(imMaze, (player.x - mazePosition.x) / MAZE_SCALE, ((player.y + PLAYER_HEIGHT + PLAYER_SPEED) - mazePosition.y) / MAZE_SCALE), WHITE) && !ColorIsEqual(GetImageColor(imMaze, (player.x + PLAYER_WIDTH - mazePosition.x) / MAZE_SCALE, ((player.y + PLAYER_HEIGHT + PLAYER_SPEED) - mazePosition.y) / MAZE_SCALE), WHITE))
-                {
-                    if ((player.x - mazePosition.x) / MAZE_SCALE < MAZE_WIDTH && (player.y - mazePosition.y) / MAZE_SCALE < MAZE_HEIGHT)
-                    {
-                        player.y += PLAYER_SPEED;
-                        currentRow = 0; 
-                    }
-                }
-            }
-            else if (IsKeyDown(KEY_LEFT) || IsKeyDown(KEY_A))
-            {
-                if (!ColorIsEqual(GetImageColor(imMaze, ((player.x - PLAYER_SPEED) - mazePosition.x) / MAZE_SCALE, (player.y - mazePosition.y) / MAZE_SCALE), WHITE) && !ColorIsEqual(GetImageColor(imMaze, ((player.x - PLAYER_SPEED) - mazePosition.x) / MAZE_SCALE, (player.y + PLAYER_HEIGHT - mazePosition.y) / MAZE_SCALE), WHITE))
-                {
-                    if ((player.x - mazePosition.x) / MAZE_SCALE > 0 && (player.y - mazePosition.y) / MAZE_SCALE > 0)
-                    {
-                        player.x -= PLAYER_SPEED;
-                        currentRow = 1; 
-                    }
-                }
-            }
-            else if (IsKeyDown(KEY_RIGHT) || IsKeyDown(KEY_D))
-            {
-                if (!ColorIsEqual(GetImageColor(imMaze, ((player.x + PLAYER_WIDTH + PLAYER_SPEED) - mazePosition.x) / MAZE_SCALE, (player.y - mazePosition.y) / MAZE_SCALE), WHITE) && !ColorIsEqual(GetImageColor(imMaze, ((player.x + PLAYER_WIDTH + PLAYER_SPEED) - mazePosition.x) / MAZE_SCALE, (player.y + PLAYER_HEIGHT - mazePosition.y) / MAZE_SCALE), WHITE))
-                {
-                    if ((player.x - mazePosition.x) / MAZE_SCALE < MAZE_WIDTH && (player.y - mazePosition.y) / MAZE_SCALE < MAZE_HEIGHT)
-                    {
-                        player.x += PLAYER_SPEED;
-                        currentRow = 2; 
-                    }
-                }
-            }
-            else
-            {
-                currentRow = 4; 
-            }
-                
-            // Music
+            showStats = !showStats;
+            statsOutdated = true;
+        }
+        EndProfileScope(PROFILE_INPUT);
 
-            UpdateMusicStream(music);   // Update music buffer with new stream data
+        replayTicks += UpdateGameFrame(&state, &clock, input, frameTime);
 
-            // Get normalized time played for current music stream
-            timePlayed = GetMusicTimePlayed(music)/GetMusicTimeLength(music);
+        // Music, streamed by audio thread whatever the game mode
+        BeginProfileScope(PROFILE_MUSIC);
 
-            if (timePlayed > 1.0f) timePlayed = 1.0f;
-            
-            // Frames
-                if (frameTime >= 0.1f) {
-                    currentFrame++;
-                    
-                    if (currentFrame >= 4) {
-                        
-                        currentFrame = 0; 
-                    }
+        if (IsKeyPressed(KEY_M))
+        {
+            musicPaused = !musicPaused;
 
-                    frameTime = 0.0f;  
-                }
-                frameTime += GetFrameTime();  
+            if (musicPaused) PauseMazeMusic();
+            else ResumeMazeMusic();
+        }
 
-            // TODO: [1p] Camera 2D system following player movement around the map
-            // Update Camera2D parameters as required to follow player and zoom control
-            camera2d.target = (Vector2){ player.x + 2, player.y + 2 };
+        UpdateMazeAudio();      // Only streams music if audio thread is not available
 
-            // TODO: [2p] Maze items pickup logic
-            if (ColorIsEqual(GetImageColor(imMaze, ((player.x + PLAYER_WIDTH / 2) - mazePosition.x) / MAZE_SCALE, ((player.y + PLAYER_HEIGHT / 2) - mazePosition.y) / MAZE_SCALE), RED))
-            {
-                Point playerPos = {
-                    (int)(((player.x + PLAYER_WIDTH / 2) - mazePosition.x)/MAZE_SCALE),
-                    (int)(((player.y + PLAYER_HEIGHT / 2) - mazePosition.y)/MAZE_SCALE),
-                };
-                
-                for (int i = 0; i < MAX_MAZE_ITEMS; i++)
-                {
-                    if (playerPos.x > mazeItems[i].x && playerPos.x < mazeItems[i].x + MAZE_WIDTH && playerPos.y > mazeItems[i].y && playerPos.y < mazeItems[i].y + MAZE_HEIGHT)
-                    {
-                        mazeItems[i] = (Point){0};
-                        countItems--;
-                        score += 50;
-                        
-                        ImageDrawPixel(&imMaze, playerPos.x, playerPos.y, BLACK);
-                        UnloadTexture(texMaze);
-                        texMaze = LoadTextureFromImage(imMaze);
-                        break;
-                    }
-                }
-            }
-            
-            
-            if (ColorIsEqual(GetImageColor(imMaze, ((player.x + PLAYER_WIDTH / 2) - mazePosition.x) / MAZE_SCALE, ((player.y + PLAYER_HEIGHT / 2) - mazePosition.y) / MAZE_SCALE), GREEN))
-            {
-                currentMode = 2;
-            }
-            
-            if (IsKeyDown(KEY_ONE))
-            {
-                currentBiome = 0;
-                currentBiome = 0;
-            }
-            else if (IsKeyDown(KEY_TWO))
-            {
-                currentBiome = 1;
-            }
-            else if (IsKeyDown(KEY_THREE))
-            {
-                currentBiome = 2;
-            }
-            else if (IsKeyDown(KEY_FOUR))
-            {
-                currentBiome = 3;
-            }
+        // Get normalized time played for current music stream
+        float timeLength = GetMazeMusicTimeLength();
+        timePlayed = (timeLength > 0.0f)? GetMazeMusicTimePlayed()/timeLength : 0.0f;
+
+        if (timePlayed > 1.0f) timePlayed = 1.0f;
+
+        EndProfileScope(PROFILE_MUSIC);
+
+        // Player position interpolated between previous and current tick
+        float alpha = clock.accumulator/SIM_TIMESTEP;
+        Rectangle player = state.player;
+        player.x = state.previousPlayer.x + (state.player.x - state.previousPlayer.x)*alpha;
+        player.y = state.previousPlayer.y + (state.player.y - state.previousPlayer.y)*alpha;
+
+        // TODO: [1p] Camera 2D system following player movement around the map
+        // Update Camera2D parameters as required to follow player and zoom control
+        camera2d.target = (Vector2){ player.x + 2, player.y + 2 };
+
+        // Mouse wheel zoom, from CAMERA_MAX_ZOOM down to the whole maze (or world view) fitting on screen
+        MazeGrid zoomGrid = state.worldMode? state.world.view : state.level.grid;
+        float minZoom = fminf(screenWidth/(zoomGrid.width*MAZE_SCALE), screenHeight/(zoomGrid.height*MAZE_SCALE));
+
+        camera2d.zoom *= powf(CAMERA_ZOOM_STEP, GetMouseWheelMove());
+        camera2d.zoom = fmaxf(fminf(minZoom, CAMERA_MAX_ZOOM), fminf(camera2d.zoom, CAMERA_MAX_ZOOM));
+
+        // Biome atlas loaded on demand, previous atlas is drawn until selected one is ready,
+        // any other biome atlas is evicted, so two atlases are resident at most
+        RequestMazeAsset(biomeAssets[state.currentBiome]);
+        if (IsMazeAssetReady(biomeAssets[state.currentBiome])) drawnBiome = state.currentBiome;
+
+        for (int i = 0; i < 4; i++)
+        {
+            if ((i != drawnBiome) && (i != state.currentBiome)) EvictMazeAsset(biomeAssets[i]);
         }
-        else if (currentMode == 1) // Editor mode
+
+        // Level cells changed since last texture update (edited, new level) are changed since last statistics too
+        BeginProfileScope(PROFILE_ANALYTICS);
+
+        if (showStats && (statsOutdated || state.level.dirty.dirty))
         {
-            // TODO: [2p] Maze editor mode, edit image pixels with mouse.
-            // Implement logic to selecte image cell from mouse position -> TIP: GetMousePosition()
-            // NOTE: Mouse position is returned in screen coordinates and it has to 
-            // transformed into image coordinates
-            // Once the cell is selected, if mouse button pressed add/remove image pixels
-            
-            // WARNING: Remember that when imMaze changes, texMaze must be also updated!
-            
-            if (IsKeyDown(KEY_LEFT_CONTROL) && IsMouseButtonDown(MOUSE_BUTTON_RIGHT))
-            {
-                Vector2 mousePos = GetMousePosition();
-                            
-                if ((mousePos.x >= mazePosition.x) && (mousePos.y >= mazePosition.y))
-                {
-                    Point mapCoord = {
-                        (int)((mousePos.x - mazePosition.x)/MAZE_SCALE),
-                        (int)((mousePos.y - mazePosition.y)/MAZE_SCALE),
-                    };
-                    
-                    if (ColorIsEqual(GetImageColor(imMaze, mapCoord.x, mapCoord.y), RED))
-                    {
-                        for (int i = 0; i < MAX_MAZE_ITEMS; i++)
-                        {
-                            if (mazeItems[i].x == mapCoord.x && mazeItems[i].y == mapCoord.y)
-                            {
-                                mazeItems[i] = (Point){0};
-                                countItems--;
-                            }
-                        }
-                    }
-                    
-                    ImageDrawPixel(&imMaze, mapCoord.x, mapCoord.y, GREEN);
-                    
-                    UnloadTexture(texMaze);
-                    texMaze = LoadTextureFromImage(imMaze);
-                }
-            }
-            else if (IsMouseButtonDown(MOUSE_BUTTON_LEFT))
-            {
-                Vector2 mousePos = GetMousePosition();
-                
-                if ((mousePos.x >= mazePosition.x) && (mousePos.y >= mazePosition.y))
-                {
-                    Point mapCoord = {
-                        (int)((mousePos.x - mazePosition.x)/MAZE_SCALE),
-                        (int)((mousePos.y - mazePosition.y)/MAZE_SCALE),
-                    };
-                    
-                    if (ColorIsEqual(GetImageColor(imMaze, mapCoord.x, mapCoord.y), RED))
-                    {
-                        for (int i = 0; i < MAX_MAZE_ITEMS; i++)
-                        {
-                            if (mazeItems[i].x == mapCoord.x && mazeItems[i].y == mapCoord.y)
-                            {
-                                mazeItems[i] = (Point){0};
-                                countItems--;
-                            }
-                        }
-                    }
-                    
-                    ImageDrawPixel(&imMaze, mapCoord.x, mapCoord.y, BLACK);
-                    
-                    UnloadTexture(texMaze);
-                    texMaze = LoadTextureFromImage(imMaze);
-                }
-            }
-            else if (IsMouseButtonDown(MOUSE_BUTTON_RIGHT))
-            {
-               Vector2 mousePos = GetMousePosition();
-                
-                if ((mousePos.x >= mazePosition.x) && (mousePos.y >= mazePosition.y))
-                {
-                    Point mapCoord = {
-                        (int)((mousePos.x - mazePosition.x)/MAZE_SCALE),
-                        (int)((mousePos.y - mazePosition.y)/MAZE_SCALE),
-                    };
-                    
-                    if (ColorIsEqual(GetImageColor(imMaze, mapCoord.x, mapCoord.y), RED))
-                    {
-                        for (int i = 0; i < MAX_MAZE_ITEMS; i++)
-                        {
-                            if (mazeItems[i].x == mapCoord.x && mazeItems[i].y == mapCoord.y)
-                            {
-                                mazeItems[i] = (Point){0};
-                                countItems--;
-                            }
-                        }
-                    }
-                    
-                    ImageDrawPixel(&imMaze, mapCoord.x, mapCoord.y, WHITE);
-                    
-                    UnloadTexture(texMaze);
-                    texMaze = LoadTextureFromImage(imMaze);
-                }
-            }
-            else if (IsMouseButtonDown(MOUSE_BUTTON_MIDDLE))
-            {
-                if (countItems < MAX_MAZE_ITEMS)
-                {
-                    Vector2 mousePos = GetMousePosition();
-                
-                    if ((mousePos.x >= mazePosition.x) && (mousePos.y >= mazePosition.y))
-                    {
-                        Point mapCoord = {
-                            (int)((mousePos.x - mazePosition.x)/MAZE_SCALE),
-                            (int)((mousePos.y - mazePosition.y)/MAZE_SCALE),
-                        };
-                        
-                        bool repeatPosItem = 0;
-                        
-                        for (int i = 0; i < MAX_MAZE_ITEMS; i++)
-                        {
-                            if (mazeItems[i].x == mapCoord.x && mazeItems[i].y == mapCoord.y)
-                            {
-                                repeatPosItem = 1;
-                                break;
-                            }
-                        }
-                        
-                        if (!repeatPosItem)
-                        {
-                            mazeItems[countItems] = mapCoord;
-                            countItems++;
-                        }
-                        
-                        ImageDrawPixel(&imMaze, mapCoord.x, mapCoord.y, RED);
-                        
-                        UnloadTexture(texMaze);
-                        texMaze = LoadTextureFromImage(imMaze);
-                    }
-                }
-            }
-        } 
+            stats = GetMazeStats(state.level.grid, 0);
+            statsOutdated = false;
+        }
+
+        EndProfileScope(PROFILE_ANALYTICS);
+
+        BeginProfileScope(PROFILE_TEXTURE_UPLOAD);
+
+        UpdateMazeAssets();     // Upload decoded assets to GPU, limited per frame
+
+        // Level size changed (level loaded from file), texture must be reallocated
+        if ((texMaze.width != state.level.grid.width) || (texMaze.height != state.level.grid.height))
+        {
+            UnloadTexture(texMaze);
+            texMaze = LoadMazeTexture(state.level.grid);
+            state.level.dirty.dirty = false;
+            mipmapsOutdated = false;
+            AddProfileCount(PROFILE_TEXTURE_UPLOADS, 1);
+        }
+
+        // Upload modified maze cells to texture, only once per frame
+        // NOTE: Mipmaps are generated again only before texture is drawn minified (zoomed out view, minimap)
+        if (state.level.dirty.dirty)
+        {
+            AddProfileCount(PROFILE_TEXTURE_UPLOADS, 1);
+            mipmapsOutdated = true;
+        }
+
+        UpdateMazeTexture(texMaze, state.level.grid, &state.level.dirty);
+
+        // Fog texture follows level size, reallocated with all cells unexplored
+        if ((texFog.width != state.level.grid.width) || (texFog.height != state.level.grid.height))
+        {
+            UnloadTexture(texFog);
+            texFog = LoadFogTexture(state.level.grid.width, state.level.grid.height);
+            AddProfileCount(PROFILE_TEXTURE_UPLOADS, 1);
+        }
+
+        if (state.level.fogDirty.dirty) AddProfileCount(PROFILE_TEXTURE_UPLOADS, 1);
+        UpdateFogTexture(texFog, state.level.visibility, &state.level.fogDirty);
+
+        EndProfileScope(PROFILE_TEXTURE_UPLOAD);
         //----------------------------------------------------------------------------------
 
         // Draw
@@ -436,50 +513,44 @@ int main(void)
 
             ClearBackground(RAYWHITE);
 
-            if (currentMode == 0 || currentMode == 2) // Game mode
+            if (state.currentMode == 0 || state.currentMode == 2) // Game mode
             {
                 // Draw maze using camera2d (for automatic positioning and scale)
                 BeginMode2D(camera2d);
                 
                 // TODO: Draw maze walls and floor using current texture biome 
-                for (int y = 0; y < imMaze.height; y++)
+                BeginProfileScope(PROFILE_TILE_DRAW);
+                // NOTE: When zoomed out, cells are smaller than a few pixels and tiles detail is not visible,
+                // mipmapped maze texture is drawn instead (one quad), so cost does not grow with visible cells
+                // World view is always drawn with tiles, its size is limited to a few chunks, with no fog
+                if (state.worldMode) AddProfileCount(PROFILE_TILE_BATCHES, DrawMazeTiles(state.world.view, GetMazeAssetTexture(biomeAssets[drawnBiome]), (Vector2){ 0.0f, 0.0f }, MAZE_SCALE, camera2d, NULL));
+                else if ((MAZE_SCALE*camera2d.zoom) < MAZE_LOD_CELL_PIXELS)
                 {
-                    for (int x = 0; x < imMaze.width; x++)
+                    // Texture minified (cells smaller than a pixel), mipmaps required
+                    if (mipmapsOutdated && ((MAZE_SCALE*camera2d.zoom) < 1.0f))
                     {
-                        if (ColorIsEqual(GetImageColor(imMaze, x, y), WHITE))
-                        {
-                            DrawTexturePro(texBiomes[currentBiome], (Rectangle){ 0, texBiomes[currentBiome].height/2, texBiomes[currentBiome].width/2, texBiomes[currentBiome].height/2 },
-                                (Rectangle){ mazePosition.x + x*MAZE_SCALE, mazePosition.y + y*MAZE_SCALE, MAZE_SCALE, MAZE_SCALE }, 
-                                (Vector2){ 0 }, 0.0f, WHITE);
-                        }
-                        else if (ColorIsEqual(GetImageColor(imMaze, x, y), BLACK))
-                        {
-                            DrawTexturePro(texBiomes[currentBiome], (Rectangle){ texBiomes[currentBiome].width/2, texBiomes[currentBiome].height/2, texBiomes[currentBiome].width/2, texBiomes[currentBiome].height/2 },
-                                (Rectangle){ mazePosition.x + x*MAZE_SCALE, mazePosition.y + y*MAZE_SCALE, MAZE_SCALE, MAZE_SCALE }, 
-                                (Vector2){ 0 }, 0.0f, WHITE);
-                        }
-                        else if (ColorIsEqual(GetImageColor(imMaze, x, y), RED))
-                        {
-                            DrawTexturePro(texBiomes[currentBiome], (Rectangle){ 0, 0, texBiomes[currentBiome].width/2, texBiomes[currentBiome].height/2 },
-                                (Rectangle){ mazePosition.x + x*MAZE_SCALE, mazePosition.y + y*MAZE_SCALE, MAZE_SCALE, MAZE_SCALE }, 
-                                (Vector2){ 0 }, 0.0f, WHITE);
-                        } 
-                         else if (ColorIsEqual(GetImageColor(imMaze, x, y), GREEN))
-                        {
-                            DrawTexturePro(texBiomes[currentBiome], (Rectangle){ texBiomes[currentBiome].width/2, 0, texBiomes[currentBiome].width/2, texBiomes[currentBiome].height/2 },
-                                (Rectangle){ mazePosition.x + x*MAZE_SCALE, mazePosition.y + y*MAZE_SCALE, MAZE_SCALE, MAZE_SCALE }, 
-                                (Vector2){ 0 }, 0.0f, WHITE);
-                        } 
+                        GenTextureMipmaps(&texMaze);
+                        mipmapsOutdated = false;
                     }
+
+                    DrawTextureEx(texMaze, state.mazePosition, 0.0f, MAZE_SCALE, WHITE);
+                    DrawTextureEx(texFog, state.mazePosition, 0.0f, MAZE_SCALE, WHITE);
                 }
+                else AddProfileCount(PROFILE_TILE_BATCHES, DrawMazeTiles(state.level.grid, GetMazeAssetTexture(biomeAssets[drawnBiome]), state.mazePosition, MAZE_SCALE, camera2d, &state.level.visibility));
+                EndProfileScope(PROFILE_TILE_DRAW);
+
                 // Actualización del fotograma del sprite (animación)
-                frameRec.y = currentRow * frameHeight; 
-                frameRec.x = currentFrame * frameWidth;  
+                frameRec.y = state.currentRow * frameHeight; 
+                frameRec.x = state.currentFrame * frameWidth;  
                 
                 // TODO: Draw player rectangle or sprite at player position
                 //DrawRectangleRec(player, BLUE);
                 DrawTexturePro(spriteSheet, frameRec, player, (Vector2){0, 0}, 0.0f, WHITE);
 
+                // Draw chasers, level agents only (not in world mode)
+                BeginProfileScope(PROFILE_AGENT_DRAW);
+                if (!state.worldMode) DrawMazeAgents(state.agents, spriteSheet, (Vector2){ frameWidth, frameHeight }, state.mazePosition, (state.currentMode == 0)? alpha : 1.0f, camera2d, RED, &state.level.visibility);
+                EndProfileScope(PROFILE_AGENT_DRAW);
 
                 // TODO: Draw maze items 2d (using sprite texture?)
 
@@ -487,50 +558,159 @@ int main(void)
                 
                 // NOTE: Game UI does not receive the camera2d transformations,
                 // it is drawn in screen space coordinates directly
-                if (currentMode == 2)
+                BeginProfileScope(PROFILE_UI_DRAW);
+
+                if ((state.currentMode == 0) && state.worldMode)
+                {
+                    // Draw world streaming info
+                    DrawText(TextFormat("CHUNK: %i, %i", state.world.viewChunk.x, state.world.viewChunk.y), 10, 160, 32, DARKGREEN);
+                    DrawText(TextFormat("CHUNKS LOADED: %i/%i", state.world.chunkCount, state.world.maxChunks), 10, 200, 32, DARKGREEN);
+                }
+                else if (state.currentMode == 0)
+                {
+                    // Draw steps to exit from player cell
+                    unsigned int exitDistance = GetMazeDistance(state.level.exitField,
+                        (int)(((state.player.x + PLAYER_WIDTH / 2) - state.mazePosition.x) / MAZE_SCALE),
+                        (int)(((state.player.y + PLAYER_HEIGHT / 2) - state.mazePosition.y) / MAZE_SCALE));
+
+                    if (exitDistance != MAZE_DISTANCE_UNREACHABLE) DrawText(TextFormat("EXIT: %u", exitDistance), 10, 160, 32, DARKGREEN);
+                    else DrawText("EXIT UNREACHABLE", 10, 160, 32, RED);
+
+                    // Draw minimap, maze texture is already kept updated with changed cells
+                    Vector2 viewMin = GetScreenToWorld2D((Vector2){ 0.0f, 0.0f }, camera2d);
+                    Rectangle viewCells = {
+                        (viewMin.x - state.mazePosition.x)/MAZE_SCALE,
+                        (viewMin.y - state.mazePosition.y)/MAZE_SCALE,
+                        screenWidth/(camera2d.zoom*MAZE_SCALE),
+                        screenHeight/(camera2d.zoom*MAZE_SCALE)
+                    };
+                    Vector2 playerCell = {
+                        ((player.x + PLAYER_WIDTH/2.0f) - state.mazePosition.x)/MAZE_SCALE,
+                        ((player.y + PLAYER_HEIGHT/2.0f) - state.mazePosition.y)/MAZE_SCALE
+                    };
+
+                    // Minimap minified if maze is bigger than minimap (in cells), mipmaps required
+                    if (mipmapsOutdated && ((texMaze.width > MINIMAP_SIZE) || (texMaze.height > MINIMAP_SIZE)))
+                    {
+                        GenTextureMipmaps(&texMaze);
+                        mipmapsOutdated = false;
+                    }
+
+                    DrawMazeMinimap(texMaze, texFog, (Rectangle){ screenWidth - MINIMAP_SIZE - 10, screenHeight - MINIMAP_SIZE - 10, MINIMAP_SIZE, MINIMAP_SIZE }, playerCell, viewCells);
+                }
+                else if (state.currentMode == 2)
                 {
                     DrawRectangleRec(deadScreen, BLACK);
                     DrawText("YOU WIN", screenWidth / 2 - 255, deadScreen.y + 50, 120, BLUE);
-                    DrawText(TextFormat("YOUR SCORE: %i", score), screenWidth / 2 - 125, screenHeight / 2 + 20, 32, WHITE);
+                    DrawText(TextFormat("YOUR SCORE: %i", state.score), screenWidth / 2 - 125, screenHeight / 2 + 20, 32, WHITE);
                     DrawText("Press [SPACE] to restart", screenWidth / 2 - 225, screenHeight / 2 + 60, 32, WHITE);
                 }
+
+                EndProfileScope(PROFILE_UI_DRAW);
             }
-            else if (currentMode == 1) // Editor mode
+            else if (state.currentMode == 1) // Editor mode
             {
                 // Draw generated maze texture, scaled and centered on screen 
-                DrawTextureEx(texMaze, mazePosition, 0.0f, MAZE_SCALE, WHITE);
+                BeginProfileScope(PROFILE_TILE_DRAW);
+                DrawTextureEx(texMaze, state.mazePosition, 0.0f, MAZE_SCALE, WHITE);
+                EndProfileScope(PROFILE_TILE_DRAW);
 
                 // Draw lines rectangle over texture, scaled and centered on screen 
-                DrawRectangleLines(mazePosition.x, mazePosition.y, MAZE_WIDTH*MAZE_SCALE, MAZE_HEIGHT*MAZE_SCALE, RED);
+                DrawRectangleLines(state.mazePosition.x, state.mazePosition.y, state.level.grid.width*MAZE_SCALE, state.level.grid.height*MAZE_SCALE, RED);
+
+                // Draw line/rectangle tool shape, applied to cells when mouse button is released
+                if (state.editActive && ((state.editTool == MAZE_EDIT_LINE) || (state.editTool == MAZE_EDIT_RECTANGLE)))
+                {
+                    Color shapeColor = Fade(GetMazeCellColor(state.editKind), 0.6f);
+                    Point start = state.editStart;
+                    Point end = state.editCursor;
+
+                    if (state.editTool == MAZE_EDIT_LINE)
+                    {
+                        DrawLineEx((Vector2){ state.mazePosition.x + (start.x + 0.5f)*MAZE_SCALE, state.mazePosition.y + (start.y + 0.5f)*MAZE_SCALE },
+                            (Vector2){ state.mazePosition.x + (end.x + 0.5f)*MAZE_SCALE, state.mazePosition.y + (end.y + 0.5f)*MAZE_SCALE }, MAZE_SCALE, shapeColor);
+                    }
+                    else
+                    {
+                        Rectangle shape = {
+                            state.mazePosition.x + ((start.x < end.x)? start.x : end.x)*MAZE_SCALE,
+                            state.mazePosition.y + ((start.y < end.y)? start.y : end.y)*MAZE_SCALE,
+                            (abs(end.x - start.x) + 1)*MAZE_SCALE,
+                            (abs(end.y - start.y) + 1)*MAZE_SCALE
+                        };
+
+                        DrawRectangleRec(shape, shapeColor);
+                        DrawRectangleLinesEx(shape, 1.0f, DARKGRAY);
+                    }
+                }
 
                 // TODO: Draw player using a rectangle, consider maze screen coordinates!
                 DrawRectangleRec(player, BLUE);
                 //DrawTexturePro(spriteSheet, frameRec, player, (Vector2){0, 0}, 0.0f, WHITE);
 
                 // TODO: Draw editor UI required elements
-                ImageDrawPixel(&imMaze, endCell.x, endCell.y, GREEN);
-                UnloadTexture(texMaze);
-                texMaze = LoadTextureFromImage(imMaze);
+                // Draw exit reachability from start cell, kept updated on every edit
+                BeginProfileScope(PROFILE_UI_DRAW);
+                unsigned int exitDistance = GetMazeDistance(state.level.startField, state.endCell.x, state.endCell.y);
+
+                if (exitDistance != MAZE_DISTANCE_UNREACHABLE) DrawText(TextFormat("PATH TO EXIT: %u", exitDistance), 10, 160, 32, DARKGREEN);
+                else DrawText("EXIT UNREACHABLE", 10, 160, 32, RED);
+
+                // Draw editor tool and undo/redo history
+                const char *toolNames[] = { "BRUSH", "LINE", "RECTANGLE", "FILL" };
+                DrawText(TextFormat("TOOL: %s", toolNames[state.editTool]), 10, 200, 32, DARKBLUE);
+                DrawText(TextFormat("UNDO: %i  REDO: %i", state.journal.doneCount, state.journal.entryCount - state.journal.doneCount), 10, 240, 20, DARKBLUE);
+                DrawText("[B] Brush  [L] Line  [R] Rectangle  [F] Fill  [CTRL+Z] Undo  [CTRL+Y] Redo", 10, screenHeight - 40, 20, BLUE);
+                EndProfileScope(PROFILE_UI_DRAW);
             }
 
-            DrawText(TextFormat("SCORE: %i", score), 10, 50, 32, RED);
+            BeginProfileScope(PROFILE_UI_DRAW);
+
+            DrawText(TextFormat("SCORE: %i", state.score), 10, 50, 32, RED);
             DrawText("Change Bioma", 10, 90, 32, BLUE);
             DrawText("[1, 2, 3, 4]", 10, 120, 32, BLUE);
+            if (state.currentMode == 0) DrawText("[TAB] Toggle world", 10, screenHeight - 40, 20, BLUE);
             
             DrawFPS(10, 10);
 
+            if (showProfiler) DrawMazeProfiler(screenWidth - 340, 10);
+            if (showStats) DrawMazeStats(stats, screenWidth - 340, 250);
+
+            EndProfileScope(PROFILE_UI_DRAW);
+
         EndDrawing();
+
+        EndProfileFrame();
         //----------------------------------------------------------------------------------
     }
 
     // De-Initialization
     //--------------------------------------------------------------------------------------
+    if (replay.frames != NULL)
+    {
+        PrintReplayReport(replayFrame, replayTicks, GetMazeTime() - replayStartTime, GetGameStateHash(&state));
+        UnloadMazeReplay(replay);
+    }
+
+    if (recordFileName != NULL)
+    {
+        if (SaveMazeReplay(recordFileName, record)) TraceLog(LOG_INFO, "REPLAY: [%s] Input recorded successfully (%i frames)", recordFileName, record.frameCount);
+        else TraceLog(LOG_WARNING, "REPLAY: [%s] Input recording could not be saved", recordFileName);
+
+        UnloadMazeReplay(record);
+    }
+
     UnloadTexture(texMaze);     // Unload maze texture from VRAM (GPU)
-    UnloadImage(imMaze);        // Unload maze image from RAM (CPU)
+    UnloadTexture(texFog);      // Unload fog texture from VRAM (GPU)
+    UnloadGameState(&state);    // Unload level, items and world from RAM (CPU)
 
-    // TODO: Unload all loaded resources
-    
-    UnloadMusicStream(music);   // Unload music stream buffers from RAM
+    // Export profiler stats summary and last frames timings
+    ExportMazeProfiler("profile.json");
+    ExportMazeProfiler("profile.csv");
+
+    CloseMazeAudio();           // Stop audio thread, before music stream is unloaded
+    CloseMazeAssets();          // Unload all assets (textures, music streams), stopping decoding workers
+    CloseMazeJobs();            // Stop jobs pool workers
 
     CloseAudioDevice();         // Close audio device (music streaming is automatically stopped)
     
@@ -540,102 +720,859 @@ int main(void)
     return 0;
 }
 
-// Generate procedural maze image, using grid-based algorithm
-// NOTE: Color scheme used: WHITE = Wall, BLACK = Walkable, RED = Item
-Image GenImageMaze(int width, int height, int spacingRows, int spacingCols, float pointChance)
+// Sample game input from keyboard and mouse
+GameInput PollGameInput(void)
 {
-    Image imMaze = { 0 };
-    
-    // TODO: [1p] Implement maze image generation algorithm
-    imMaze = GenImageColor(width, height, BLACK);
+    GameInput input = { 0 };
 
-    // STEP 1.2: Draw image border
-    for (int y = 0; y < imMaze.height; y++)
-    {
-        for (int x = 0; x < imMaze.width; x++)
-        {
-            if ((x == 0) || (x == (imMaze.width - 1)) ||
-                (y == 0) || (y == (imMaze.height - 1))) 
-            {
-                ImageDrawPixel(&imMaze, x, y, WHITE);
-            }
-        }
-    }
-    //---------------------------------------------------------------------------------
-    
-    // STEP 2: Set some random point in image at specific row-column distances
-    //---------------------------------------------------------------------------------
-    // STEP 2.1: Define an array of point used for maze generation
-    // NOTE A: Static array allocation, memory allocated in STACK (MAX: 1MB)
-    // NOTE B: Dynamic array allocation, memory allocated in HEAP (MAX: Available RAM)
-    //Point mazePoints[64] = { 0 }; // Static array
-    Point *mazePoints = malloc(256*sizeof(Point)); // Dynamic array (MAX: 256 points)
-    int mazePointCounter = 0;
-    
-    // STEP 2.2: Store specific points, at specific row-column distances
-    for (int y = 0; y < imMaze.height; y++)
-    {
-        for (int x = 0; x < imMaze.width; x++)
-        {
-            if ((x != 0) && (x != (imMaze.width - 1)) &&
-                (y != 0) && (y != (imMaze.height - 1)))
-            {
-                if ((x%spacingCols == 0) && (y%spacingRows == 0))
-                {
-                    if (GetRandomValue(0, 100) <= (int)(pointChance*100)) 
-                    {
-                        mazePoints[mazePointCounter] = (Point){ x, y };
-                        mazePointCounter++;
-                    }
-                }
-            }
-        }
+    if (IsKeyDown(KEY_UP) || IsKeyDown(KEY_W)) input.actionsDown |= ACTION_MOVE_UP;
+    if (IsKeyDown(KEY_DOWN) || IsKeyDown(KEY_S)) input.actionsDown |= ACTION_MOVE_DOWN;
+    if (IsKeyDown(KEY_LEFT) || IsKeyDown(KEY_A)) input.actionsDown |= ACTION_MOVE_LEFT;
+    if (IsKeyDown(KEY_RIGHT) || IsKeyDown(KEY_D)) input.actionsDown |= ACTION_MOVE_RIGHT;
+    if (IsKeyDown(KEY_ONE)) input.actionsDown |= ACTION_BIOME_1;
+    if (IsKeyDown(KEY_TWO)) input.actionsDown |= ACTION_BIOME_2;
+    if (IsKeyDown(KEY_THREE)) input.actionsDown |= ACTION_BIOME_3;
+    if (IsKeyDown(KEY_FOUR)) input.actionsDown |= ACTION_BIOME_4;
+    if (IsKeyDown(KEY_LEFT_CONTROL)) input.actionsDown |= ACTION_EDIT_EXIT;
+    if (IsMouseButtonDown(MOUSE_BUTTON_LEFT)) input.actionsDown |= ACTION_EDIT_FLOOR;
+    if (IsMouseButtonDown(MOUSE_BUTTON_RIGHT)) input.actionsDown |= ACTION_EDIT_WALL;
+    if (IsMouseButtonDown(MOUSE_BUTTON_MIDDLE)) input.actionsDown |= ACTION_EDIT_ITEM;
+
+    if (IsKeyPressed(KEY_SPACE)) input.actionsPressed |= ACTION_TOGGLE_MODE;
+    if (IsKeyPressed(KEY_TAB)) input.actionsPressed |= ACTION_TOGGLE_WORLD;
+    if (IsKeyPressed(KEY_F5)) input.actionsPressed |= ACTION_SAVE_LEVEL;
+    if (IsKeyPressed(KEY_F9)) input.actionsPressed |= ACTION_LOAD_LEVEL;
+    if (IsKeyPressed(KEY_B)) input.actionsPressed |= ACTION_TOOL_BRUSH;
+    if (IsKeyPressed(KEY_L)) input.actionsPressed |= ACTION_TOOL_LINE;
+    if (IsKeyPressed(KEY_R)) input.actionsPressed |= ACTION_TOOL_RECTANGLE;
+    if (IsKeyPressed(KEY_F)) input.actionsPressed |= ACTION_TOOL_FILL;
+    if (IsKeyDown(KEY_LEFT_CONTROL) && IsKeyPressed(KEY_Z)) input.actionsPressed |= ACTION_UNDO;
+    if (IsKeyDown(KEY_LEFT_CONTROL) && IsKeyPressed(KEY_Y)) input.actionsPressed |= ACTION_REDO;
+
+    input.mousePosition = GetMousePosition();
+
+    return input;
+}
+
+// Generate a new level, reseting player and items
+// NOTE: Same seed is used, so same maze is always generated
+void ResetGameLevel(GameState *state)
+{
+    MazeLevel *level = &state->level;
+
+    // Random seed defines the random numbers generation,
+    // always the same if using the same seed
+    SetRandomSeed(MAZE_SEED);
+
+    UnloadGameLevel(level);
+    ReserveGameLevel(level, MAZE_WIDTH, MAZE_HEIGHT);
+    level->grid = GenMazeGridArena(&level->arena, MAZE_WIDTH, MAZE_HEIGHT, SPACING_ROWS, SPACING_COLS, POINT_CHANCE);
+
+    // Player start-position and end-position initialization
+    state->startCell = (Point){ 1, 1 };
+    state->endCell = (Point){ MAZE_WIDTH - 2, MAZE_HEIGHT - 2 };
+    SetMazeCell(&level->grid, state->endCell.x, state->endCell.y, MAZE_CELL_EXIT);
+
+    // Compute distances to end and start cells, for reachability and path queries
+    level->exitField = LoadMazeDistanceFieldArena(&level->arena, level->grid, state->endCell);
+    level->startField = LoadMazeDistanceFieldArena(&level->arena, level->grid, state->startCell);
+    level->chaseField = LoadMazeDistanceFieldArena(&level->arena, level->grid, state->startCell);
+    level->visibility = LoadMazeVisibilityArena(&level->arena, level->grid.width, level->grid.height, FOG_VIEW_RADIUS);
+
+    // Full textures must be updated (reallocated by main loop if maze size changed)
+    level->dirty = (MazeDirtyRegion){ true, 0, 0, level->grid.width - 1, level->grid.height - 1 };
+    level->fogDirty = level->dirty;
+
+    ClearMazeItems(&state->items);
+
+    // Edit history refers to previous level cells
+    ClearMazeEditJournal(&state->journal);
+    state->editActive = false;
+
+    // Define player position and size
+    state->worldMode = false;
+    CenterGameLevel(state);
+    SetPlayerCell(state, state->mazePosition, state->startCell);
+    state->score = 0;
+}
+
+// Load level from file, reseting player and items
+// NOTE: Level file is memory-mapped, grid cells are used in place
+bool LoadGameLevel(GameState *state, const char *fileName)
+{
+    MazeLevel *level = &state->level;
+    MazeFile file = LoadMazeFile(fileName);
+
+    if (file.grid.cells == NULL)
+    {
+        TraceLog(LOG_WARNING, "MAZE: [%s] Level file could not be loaded", fileName);
+        return false;
     }
 
-    // STEP 2.3: Draw our points in image
-    for (int i = 0; i < mazePointCounter; i++) 
+    // NOTE: Previous level is unloaded after new one is loaded, same file can be loaded again
+    UnloadGameLevel(level);
+    ReserveGameLevel(level, file.grid.width, file.grid.height);
+    level->file = file;
+    level->grid = file.grid;
+
+    state->startCell = file.startCell;
+    state->endCell = file.endCell;
+
+    level->exitField = LoadMazeDistanceFieldArena(&level->arena, level->grid, state->endCell);
+    level->startField = LoadMazeDistanceFieldArena(&level->arena, level->grid, state->startCell);
+    level->chaseField = LoadMazeDistanceFieldArena(&level->arena, level->grid, state->startCell);
+    level->visibility = LoadMazeVisibilityArena(&level->arena, level->grid.width, level->grid.height, FOG_VIEW_RADIUS);
+    level->dirty = (MazeDirtyRegion){ true, 0, 0, level->grid.width - 1, level->grid.height - 1 };
+    level->fogDirty = level->dirty;
+
+    ClearMazeItems(&state->items);
+    for (int i = 0; i < file.itemCount; i++) AddMazeItem(&state->items, file.items[i].cell, file.items[i].value);
+
+    ClearMazeEditJournal(&state->journal);
+    state->editActive = false;
+
+    state->worldMode = false;
+    CenterGameLevel(state);
+    SetPlayerCell(state, state->mazePosition, state->startCell);
+    state->score = 0;
+
+    TraceLog(LOG_INFO, "MAZE: [%s] Level loaded successfully (%i x %i)", fileName, level->grid.width, level->grid.height);
+
+    return true;
+}
+
+// Unload level grid and distance fields
+// NOTE: Level arena memory is kept, to be used by next level
+void UnloadGameLevel(MazeLevel *level)
+{
+    // Grid cells are file data if level was loaded from file, arena memory otherwise
+    if (level->file.data != NULL) UnloadMazeFile(level->file);
+
+    ResetMazeArena(&level->arena);
+
+    level->grid = (MazeGrid){ 0 };
+    level->file = (MazeFile){ 0 };
+    level->exitField = (MazeDistanceField){ 0 };
+    level->startField = (MazeDistanceField){ 0 };
+    level->chaseField = (MazeDistanceField){ 0 };
+    level->visibility = (MazeVisibility){ 0 };
+}
+
+// Make sure level arena fits a level of given size: generated grid cells, generator
+// working memory, three distance fields (distances and queue) and visibility bitsets
+// NOTE: Arena is only reallocated if level is bigger than any previous one, must be called with level unloaded
+void ReserveGameLevel(MazeLevel *level, int width, int height)
+{
+    size_t cellCount = (size_t)width*height;
+    size_t required = cellCount +                                   // Grid cells
+        (cellCount/(SPACING_ROWS*SPACING_COLS) + 1)*sizeof(int) +   // Generator points
+        3*cellCount*(sizeof(unsigned int) + sizeof(int)) +          // Distance fields
+        2*(size_t)height*((width + 63)/64)*sizeof(unsigned long long) +  // Visibility bitsets
+        12*MAZE_ARENA_ALIGNMENT;                                    // Allocations alignment
+
+    if (level->arena.capacity < required)
     {
-        ImageDrawPixel(&imMaze, mazePoints[i].x, mazePoints[i].y, WHITE);
+        UnloadMazeArena(level->arena);
+        level->arena = LoadMazeArena(required);
     }
-    //---------------------------------------------------------------------------------
-
-    // STEP 3: Draw lines from every point in a random direction
-    //---------------------------------------------------------------------------------
-    // STEP 3.1: Define an array of 4 directions for convenience
-    Point directions[4] = {
-        { 1, 0 },   // East
-        { -1, 0 },  // West
-        { 0, 1 },   // South
-        { 0, -1 },  // North
+}
+
+// Set maze drawing position, level centered on maze center
+// NOTE: Level size changes with loaded levels, maze is always drawn centered
+void CenterGameLevel(GameState *state)
+{
+    state->mazePosition = (Vector2){
+        state->mazeCenter.x - state->level.grid.width*MAZE_SCALE/2,
+        state->mazeCenter.y - state->level.grid.height*MAZE_SCALE/2
     };
+}
+
+// Place player at cell, for maze drawn at origin
+void SetPlayerCell(GameState *state, Vector2 origin, Point cell)
+{
+    state->player = (Rectangle){ origin.x + cell.x * MAZE_SCALE + 2, origin.y + cell.y * MAZE_SCALE + 2, PLAYER_WIDTH, PLAYER_HEIGHT };
+    state->previousPlayer = (Vector2){ state->player.x, state->player.y };
+}
+
+// Spawn level chasers on random cells, far enough from player
+// NOTE: Random cells are picked from a stream of the maze seed, same chasers for same level and player cell
+void SpawnGameAgents(GameState *state)
+{
+    MazeLevel *level = &state->level;
+    MazeAgents *agents = &state->agents;
+    MazeRandom rng = InitMazeRandom(MAZE_SEED, AGENT_RANDOM_STREAM);
+
+    ClearMazeAgents(agents);
+
+    if ((level->grid.width == 0) || (level->grid.height == 0)) return;
+
+    // Chasers flow field source set to player cell, spawn cells must reach it
+    Point playerCell = {
+        (int)(((state->player.x + PLAYER_WIDTH/2.0f) - state->mazePosition.x)/MAZE_SCALE),
+        (int)(((state->player.y + PLAYER_HEIGHT/2.0f) - state->mazePosition.y)/MAZE_SCALE),
+    };
+
+    SetMazeDistanceFieldSource(&level->chaseField, level->grid, playerCell);
+
+    // Attempts are limited, levels could have few cells far enough from player
+    for (int attempt = 0; (attempt < AGENT_COUNT*16) && (agents->count < agents->capacity); attempt++)
+    {
+        Point cell = { GetMazeRandomValue(&rng, 0, level->grid.width - 1), GetMazeRandomValue(&rng, 0, level->grid.height - 1) };
+        unsigned int distance = GetMazeDistance(level->chaseField, cell.x, cell.y);
+
+        if ((distance == MAZE_DISTANCE_UNREACHABLE) || (distance < AGENT_SPAWN_DISTANCE)) continue;
+
+        // Agents positions are maze local, random offset inside cell
+        Vector2 position = {
+            cell.x*MAZE_SCALE + GetMazeRandomValue(&rng, 0, (int)(MAZE_SCALE - AGENT_SIZE)),
+            cell.y*MAZE_SCALE + GetMazeRandomValue(&rng, 0, (int)(MAZE_SCALE - AGENT_SIZE))
+        };
+
+        AddMazeAgent(agents, position, GetMazeRandomValue(&rng, 0, MAZE_AGENT_FRAMES - 1));
+    }
+}
+
+// Update visible cells from player cell, registering changed cells in fog dirty region
+// NOTE: Cell (-1, -1) clears visible cells, so visibility is computed again on next update
+void UpdateGameVisibility(MazeLevel *level, Point cell)
+{
+    MazeVisibility *visibility = &level->visibility;
+    Point previous = visibility->origin;
+
+    if (!UpdateMazeVisibility(visibility, level->grid, cell)) return;
+
+    // Changed cells are all in view radius areas around previous and new cells
+    Point origins[2] = { previous, cell };
+
+    for (int i = 0; i < 2; i++)
+    {
+        if ((origins[i].x < 0) || (origins[i].y < 0)) continue;
+
+        AddMazeDirtyRegion(&level->fogDirty,
+            (origins[i].x - visibility->radius < 0)? 0 : origins[i].x - visibility->radius,
+            (origins[i].y - visibility->radius < 0)? 0 : origins[i].y - visibility->radius,
+            (origins[i].x + visibility->radius >= visibility->width)? visibility->width - 1 : origins[i].x + visibility->radius,
+            (origins[i].y + visibility->radius >= visibility->height)? visibility->height - 1 : origins[i].y + visibility->radius);
+    }
+}
+
+// Update game state, one simulation tick
+// NOTE: Only game state is modified, no input is read and nothing is drawn or uploaded to GPU
+void UpdateGame(GameState *state, GameInput input, float deltaTime)
+{
+    MazeLevel *level = &state->level;
+    Rectangle *player = &state->player;
+    Vector2 mazePosition = state->mazePosition;
+
+    state->previousPlayer = (Vector2){ player->x, player->y };
+
+    // Select current mode as desired
+    if (input.actionsPressed & ACTION_TOGGLE_MODE) // Toggle mode: 0-Game, 1-Editor
+    {
+        if (state->currentMode == 0)
+        {
+            state->currentMode = 1;
+
+            // Editor works on level, player back to level start
+            if (state->worldMode)
+            {
+                state->worldMode = false;
+                SetPlayerCell(state, mazePosition, state->startCell);
+            }
+        }
+        else if (state->currentMode == 1)
+        {
+            // Edit in progress is finished before leaving editor
+            if (state->editActive)
+            {
+                ApplyMazeEditBatch(level, &state->items, &state->journal, EndMazeEdit(&state->journal));
+                state->editActive = false;
+            }
 
-    // STEP 3.2: Load a random sequence of points, to be used as indices, so,
-    // we can access maze-points randomly indexed, instead of following the order we stored them
-    int *pointOrder = LoadRandomSequence(mazePointCounter, 0, mazePointCounter - 1);
+            state->currentMode = 0;
 
-    // STEP 3.3: Process every random maze point, drawing pixels in one random direction,
-    // until we collision with another wall (WHITE pixel)
-    for (int i = 0; i < mazePointCounter; i++) 
+            // Level could be changed in editor, chasers spawned again and visibility computed again
+            SpawnGameAgents(state);
+            UpdateGameVisibility(level, (Point){ -1, -1 });
+        }
+        else if (state->currentMode == 2)
+        {
+            state->currentMode = 1;
+
+            // Restart same level, loaded again from file if it was loaded from file
+            if ((state->level.file.data == NULL) || !LoadGameLevel(state, MAZE_LEVEL_FILE)) ResetGameLevel(state);
+        }
+    }
+
+    if ((state->currentMode == 0) && (input.actionsPressed & ACTION_TOGGLE_WORLD) && (state->world.chunks != NULL))
     {
-        Point currentPoint = mazePoints[pointOrder[i]];
-        Point currentDir = directions[GetRandomValue(0, 3)];
-        Point nextPoint = { currentPoint.x + currentDir.x, currentPoint.y + currentDir.y };
+        // Toggle world mode, world view grid is drawn at (0, 0), player starts
+        // at world cell (1, 1), always walkable (first chunk corridor)
+        state->worldMode = !state->worldMode;
+
+        if (state->worldMode)
+        {
+            UpdateMazeWorldView(&state->world, (Point){ 1, 1 });
+            SetPlayerCell(state, (Vector2){ 0.0f, 0.0f }, (Point){ 1 - state->world.viewOrigin.x, 1 - state->world.viewOrigin.y });
+        }
+        else SetPlayerCell(state, mazePosition, state->startCell);
+    }
+
+    if (state->currentMode == 0) // Game mode
+    {
+        // TODO: [2p] Player 2D movement from predefined Start-point to End-point
+        // Implement maze 2D player movement logic (cursors || WASD)
+        // Use level.grid cells information to check collisions
+        // Detect if current playerCell == endCell to finish game
         
-        while(ColorIsEqual(GetImageColor(imMaze, nextPoint.x, nextPoint.y), BLACK))
+        // Player movement direction from input, moving in both axis at once is allowed
+        Vector2 direction = { 0 };
+
+        if (input.actionsDown & ACTION_MOVE_UP) direction.y -= 1.0f;
+        if (input.actionsDown & ACTION_MOVE_DOWN) direction.y += 1.0f;
+        if (input.actionsDown & ACTION_MOVE_LEFT) direction.x -= 1.0f;
+        if (input.actionsDown & ACTION_MOVE_RIGHT) direction.x += 1.0f;
+
+        // Keep same speed on diagonal movement
+        if ((direction.x != 0.0f) && (direction.y != 0.0f))
+        {
+            direction.x *= 0.70710678f;
+            direction.y *= 0.70710678f;
+        }
+
+        // In world mode, player moves in world view grid, drawn at (0, 0)
+        BeginProfileScope(PROFILE_MOVEMENT);
+        MazeGrid grid = level->grid;
+        Vector2 origin = mazePosition;
+
+        if (state->worldMode)
+        {
+            grid = state->world.view;
+            origin = (Vector2){ 0.0f, 0.0f };
+        }
+
+        // Move player resolving collisions against maze walls (swept AABB),
+        // player box is moved in maze local coordinates
+        Rectangle localPlayer = { player->x - origin.x, player->y - origin.y, player->width, player->height };
+        MazeMoveResult move = MoveMazeBox(grid, MAZE_SCALE, localPlayer, (Vector2){ direction.x*PLAYER_SPEED, direction.y*PLAYER_SPEED });
+
+        player->x = move.box.x + origin.x;
+        player->y = move.box.y + origin.y;
+
+        if (state->worldMode)
+        {
+            // Keep view centered on player chunk, chunks are generated as player approaches them
+            // NOTE: Player is moved with the view, so positions stay small (float precision) whatever the distance travelled
+            Point viewOrigin = state->world.viewOrigin;
+            Point playerCell = {
+                viewOrigin.x + (int)((player->x + PLAYER_WIDTH / 2)/MAZE_SCALE),
+                viewOrigin.y + (int)((player->y + PLAYER_HEIGHT / 2)/MAZE_SCALE),
+            };
+
+            if (UpdateMazeWorldView(&state->world, playerCell))
+            {
+                Vector2 shift = {
+                    (viewOrigin.x - state->world.viewOrigin.x)*MAZE_SCALE,
+                    (viewOrigin.y - state->world.viewOrigin.y)*MAZE_SCALE
+                };
+
+                player->x += shift.x;
+                player->y += shift.y;
+                state->previousPlayer.x += shift.x;
+                state->previousPlayer.y += shift.y;
+            }
+        }
+
+        EndProfileScope(PROFILE_MOVEMENT);
+
+        // Select character animation row from movement direction
+        if (direction.y < 0.0f) state->currentRow = 3;
+        else if (direction.y > 0.0f) state->currentRow = 0;
+        else if (direction.x < 0.0f) state->currentRow = 1;
+        else if (direction.x > 0.0f) state->currentRow = 2;
+        else state->currentRow = 4;
+
+        // Frames
+        if (state->frameTime >= 0.1f)
         {
-            ImageDrawPixel(&imMaze, nextPoint.x, nextPoint.y, WHITE);
+            state->currentFrame++;
             
-            nextPoint.x += currentDir.x;
-            nextPoint.y += currentDir.y;
+            if (state->currentFrame >= 4) state->currentFrame = 0; 
+
+            state->frameTime = 0.0f;  
         }
+
+        state->frameTime += deltaTime;  
+
+        // TODO: [2p] Maze items pickup logic
+        // NOTE: World chunks have no items or exit, only level is checked
+        BeginProfileScope(PROFILE_PICKUP);
+        Point playerPos = {
+            (int)(((player->x + PLAYER_WIDTH / 2) - mazePosition.x)/MAZE_SCALE),
+            (int)(((player->y + PLAYER_HEIGHT / 2) - mazePosition.y)/MAZE_SCALE),
+        };
+
+        MazeItem item = { 0 };
+
+        if (!state->worldMode && (GetMazeCell(level->grid, playerPos.x, playerPos.y) == MAZE_CELL_ITEM) &&
+            RemoveMazeItem(&state->items, playerPos, &item))
+        {
+            state->score += item.value;
+
+            EditMazeCell(level, playerPos, MAZE_CELL_FLOOR);
+        }
+        
+        if (!state->worldMode && (GetMazeCell(level->grid, playerPos.x, playerPos.y) == MAZE_CELL_EXIT))
+        {
+            state->currentMode = 2;
+        }
+
+        EndProfileScope(PROFILE_PICKUP);
+
+        // Player field of view, only computed when player enters a new cell
+        BeginProfileScope(PROFILE_VISIBILITY);
+        if (!state->worldMode) UpdateGameVisibility(level, playerPos);
+        EndProfileScope(PROFILE_VISIBILITY);
+
+        // Chasers follow player in level, flow field only recomputed when player enters a new cell
+        BeginProfileScope(PROFILE_AGENTS);
+
+        if (!state->worldMode)
+        {
+            Vector2 target = {
+                (player->x + PLAYER_WIDTH/2.0f) - mazePosition.x,
+                (player->y + PLAYER_HEIGHT/2.0f) - mazePosition.y
+            };
+
+            SetMazeDistanceFieldSource(&level->chaseField, level->grid, (Point){ (int)(target.x/MAZE_SCALE), (int)(target.y/MAZE_SCALE) });
+            UpdateMazeAgents(&state->agents, level->grid, MAZE_SCALE, level->chaseField, target, deltaTime, 0);
+        }
+
+        EndProfileScope(PROFILE_AGENTS);
+        
+        if (input.actionsDown & ACTION_BIOME_1) state->currentBiome = 0;
+        else if (input.actionsDown & ACTION_BIOME_2) state->currentBiome = 1;
+        else if (input.actionsDown & ACTION_BIOME_3) state->currentBiome = 2;
+        else if (input.actionsDown & ACTION_BIOME_4) state->currentBiome = 3;
     }
-    
-    // If using dynamic memory allocation for mazePoints,
-    // they allocated memory must be manually freed 
-    free(mazePoints);
-    
-    // Free pointOrder array, allocated internally by LoadRandomSequence()
-    UnloadRandomSequence(pointOrder);
-    
-    return imMaze;
-}
\ No newline at end of file
+    else if (state->currentMode == 1) // Editor mode
+    {
+        // TODO: [2p] Maze editor mode, edit image pixels with mouse.
+        // Implement logic to selecte image cell from mouse position -> TIP: GetMousePosition()
+        // NOTE: Mouse position is returned in screen coordinates and it has to 
+        // transformed into image coordinates
+        // Once the cell is selected, if mouse button pressed add/remove image pixels
+        
+        // Save/load edited level, saved file is loaded again on level restart
+        if (input.actionsPressed & ACTION_SAVE_LEVEL)
+        {
+            if (SaveMazeFile(MAZE_LEVEL_FILE, level->grid, state->startCell, state->endCell, state->items)) TraceLog(LOG_INFO, "MAZE: [%s] Level saved successfully", MAZE_LEVEL_FILE);
+            else TraceLog(LOG_WARNING, "MAZE: [%s] Level could not be saved", MAZE_LEVEL_FILE);
+        }
+        else if (input.actionsPressed & ACTION_LOAD_LEVEL) LoadGameLevel(state, MAZE_LEVEL_FILE);
+
+        // Select editor tool, undo and redo, only allowed while no edit is in progress
+        if (!state->editActive)
+        {
+            if (input.actionsPressed & ACTION_TOOL_BRUSH) state->editTool = MAZE_EDIT_BRUSH;
+            else if (input.actionsPressed & ACTION_TOOL_LINE) state->editTool = MAZE_EDIT_LINE;
+            else if (input.actionsPressed & ACTION_TOOL_RECTANGLE) state->editTool = MAZE_EDIT_RECTANGLE;
+            else if (input.actionsPressed & ACTION_TOOL_FILL) state->editTool = MAZE_EDIT_FILL;
+
+            if (input.actionsPressed & ACTION_UNDO) ApplyMazeEditBatch(level, &state->items, &state->journal, UndoMazeEdit(&state->journal, &level->grid));
+            else if (input.actionsPressed & ACTION_REDO) ApplyMazeEditBatch(level, &state->items, &state->journal, RedoMazeEdit(&state->journal, &level->grid));
+        }
+
+        // WARNING: level.grid changes must be recorded in journal and applied with ApplyMazeEditBatch(),
+        // so items, distance fields and texMaze are kept in sync
+        Vector2 mousePos = input.mousePosition;
+        Point mapCoord = {
+            (int)((mousePos.x - mazePosition.x)/MAZE_SCALE),
+            (int)((mousePos.y - mazePosition.y)/MAZE_SCALE),
+        };
+
+        // Select cell kind to set, depending on mouse button held
+        MazeCell editKind = MAZE_CELL_FLOOR;
+        bool editing = true;
+
+        if ((input.actionsDown & ACTION_EDIT_EXIT) && (input.actionsDown & ACTION_EDIT_WALL)) editKind = MAZE_CELL_EXIT;
+        else if (input.actionsDown & ACTION_EDIT_FLOOR) editKind = MAZE_CELL_FLOOR;
+        else if (input.actionsDown & ACTION_EDIT_WALL) editKind = MAZE_CELL_WALL;
+        else if (input.actionsDown & ACTION_EDIT_ITEM) editKind = MAZE_CELL_ITEM;
+        else editing = false;
+
+        BeginProfileScope(PROFILE_EDIT);
+
+        // Edit begins when a mouse button is pressed over maze, cell kind is kept until released
+        if (editing && !state->editActive && (mousePos.x >= mazePosition.x) && (mousePos.y >= mazePosition.y) &&
+            (mapCoord.x < level->grid.width) && (mapCoord.y < level->grid.height))
+        {
+            BeginMazeEdit(&state->journal);
+            state->editActive = true;
+            state->editKind = editKind;
+            state->editStart = mapCoord;
+            state->editCursor = mapCoord;
+        }
+
+        if (state->editActive)
+        {
+            // Shapes can be dragged out of maze, cursor is clamped to maze cells
+            Point previousCursor = state->editCursor;
+            state->editCursor.x = (mapCoord.x < 0)? 0 : (mapCoord.x >= level->grid.width)? level->grid.width - 1 : mapCoord.x;
+            state->editCursor.y = (mapCoord.y < 0)? 0 : (mapCoord.y >= level->grid.height)? level->grid.height - 1 : mapCoord.y;
+
+            // Brush paints every tick, as a line from previous cursor, so fast mouse movements leave no gaps;
+            // shapes are only applied when mouse button is released
+            if (state->editTool == MAZE_EDIT_BRUSH) EditMazeGridLine(&state->journal, &level->grid, previousCursor, state->editCursor, state->editKind);
+            else if (!editing)
+            {
+                if (state->editTool == MAZE_EDIT_LINE) EditMazeGridLine(&state->journal, &level->grid, state->editStart, state->editCursor, state->editKind);
+                else if (state->editTool == MAZE_EDIT_RECTANGLE) EditMazeGridRectangle(&state->journal, &level->grid, state->editStart, state->editCursor, state->editKind);
+                else if (state->editTool == MAZE_EDIT_FILL) EditMazeGridFill(&state->journal, &level->grid, state->editStart, state->editKind);
+            }
+
+            // Keep end cell in place, in case it was overwritten by editing
+            EditMazeGridCell(&state->journal, &level->grid, state->endCell, MAZE_CELL_EXIT);
+
+            // All cells changed this tick are applied at once, edit is recorded as one entry when released
+            if (editing) ApplyMazeEditBatch(level, &state->items, &state->journal, FlushMazeEdit(&state->journal));
+            else
+            {
+                ApplyMazeEditBatch(level, &state->items, &state->journal, EndMazeEdit(&state->journal));
+                state->editActive = false;
+            }
+        }
+
+        EndProfileScope(PROFILE_EDIT);
+    }
+}
+
+// Init game state, level generated and player at start cell
+void InitGameState(GameState *state, int screenWidth, int screenHeight)
+{
+    // Current application mode
+    state->currentMode = 1;  // 0-Game, 1-Editor
+
+    // Maze drawing center (editor mode), position is set for every level size
+    state->mazeCenter = (Vector2){ screenWidth/2, screenHeight/2 };
+
+    // Maze items store, grows as required while adding items
+    state->items = LoadMazeItems(0);
+
+    // Chasers store, allocated once, chasers spawned again when game mode begins
+    state->agents = LoadMazeAgents(AGENT_COUNT, AGENT_SIZE, AGENT_SPEED);
+
+    // Editor undo/redo journal, oldest edits dropped when exceeding default budget
+    state->journal = LoadMazeEditJournal(0);
+
+    // Chunked world, only the chunks around the player are kept in memory
+    state->world = LoadMazeWorld(MAZE_SEED, SPACING_ROWS, POINT_CHANCE, WORLD_VIEW_CHUNKS, WORLD_MAX_CHUNKS);
+
+    ResetGameLevel(state);
+}
+
+// Unload game state data (level, items, world)
+void UnloadGameState(GameState *state)
+{
+    UnloadGameLevel(&state->level);
+    UnloadMazeArena(state->level.arena);
+    UnloadMazeItems(state->items);
+    UnloadMazeAgents(state->agents);
+    UnloadMazeEditJournal(state->journal);
+    UnloadMazeWorld(state->world);
+}
+
+// Run simulation ticks for frame time, returns ticks run
+// NOTE: Same code path for interactive play, windowed replay and headless replay
+int UpdateGameFrame(GameState *state, GameClock *clock, GameInput input, float frameTime)
+{
+    int ticks = 0;
+
+    // NOTE: Pressed actions are kept until consumed, frames can run without any tick
+    clock->pendingPressed |= input.actionsPressed;
+
+    if (frameTime > SIM_MAX_FRAME_TIME) frameTime = SIM_MAX_FRAME_TIME;
+
+    clock->accumulator += frameTime;
+
+    while (clock->accumulator >= SIM_TIMESTEP)
+    {
+        input.actionsPressed = clock->pendingPressed;
+        clock->pendingPressed = 0;
+
+        UpdateGame(state, input, SIM_TIMESTEP);
+
+        clock->accumulator -= SIM_TIMESTEP;
+        ticks++;
+    }
+
+    return ticks;
+}
+
+// Get game state hash (FNV-1a), for replays validation
+// NOTE: Only simulated state is hashed, same input must always give the same hash
+unsigned long long GetGameStateHash(const GameState *state)
+{
+    unsigned long long hash = 0xcbf29ce484222325ULL;
+    const MazeGrid grid = state->level.grid;
+
+    for (int i = 0; i < grid.width*grid.height; i++) hash = (hash ^ grid.cells[i])*0x100000001b3ULL;
+
+    int values[12] = {
+        state->currentMode, state->worldMode, state->world.viewOrigin.x, state->world.viewOrigin.y,
+        state->items.count, state->currentBiome, state->score, state->currentFrame, state->currentRow,
+        grid.width, grid.height, 0
+    };
+    float positions[4] = { state->player.x, state->player.y, state->previousPlayer.x, state->previousPlayer.y };
+    unsigned char bytes[sizeof(values) + sizeof(positions)] = { 0 };
+
+    memcpy(bytes, values, sizeof(values));
+    memcpy(bytes + sizeof(values), positions, sizeof(positions));
+
+    for (int i = 0; i < (int)sizeof(bytes); i++) hash = (hash ^ bytes[i])*0x100000001b3ULL;
+
+    // Chasers are updated in parallel, hashed to validate results never depend on threads
+    const MazeAgents agents = state->agents;
+
+    for (int i = 0; i < agents.count; i++)
+    {
+        float agent[2] = { agents.positionX[i], agents.positionY[i] };
+        unsigned char agentBytes[sizeof(agent)] = { 0 };
+
+        memcpy(agentBytes, agent, sizeof(agent));
+
+        for (int b = 0; b < (int)sizeof(agentBytes); b++) hash = (hash ^ agentBytes[b])*0x100000001b3ULL;
+    }
+
+    return hash;
+}
+
+// Replay recorded input with no window, GPU or audio device, as fast as possible
+int RunHeadlessReplay(MazeReplay replay, int screenWidth, int screenHeight)
+{
+    GameState state = { 0 };
+    GameClock clock = { 0 };
+    int ticks = 0;
+
+    InitGameState(&state, screenWidth, screenHeight);
+
+    double startTime = GetMazeTime();
+
+    for (int i = 0; i < replay.frameCount; i++)
+    {
+        MazeReplayFrame frame = replay.frames[i];
+        GameInput input = { frame.actionsDown, frame.actionsPressed, frame.mousePosition };
+
+        ticks += UpdateGameFrame(&state, &clock, input, frame.frameTime);
+    }
+
+    PrintReplayReport(replay.frameCount, ticks, GetMazeTime() - startTime, GetGameStateHash(&state));
+
+    UnloadGameState(&state);
+
+    return 0;
+}
+
+// Print replay timing and state hash
+void PrintReplayReport(int frames, int ticks, double elapsed, unsigned long long hash)
+{
+    printf("replay_frames: %i\n", frames);
+    printf("sim_ticks: %i\n", ticks);
+    printf("replay_s: %.3f\n", elapsed);
+    printf("ticks_per_s: %.0f\n", (elapsed > 0.0)? ticks/elapsed : 0.0);
+    printf("state_hash: 0x%016llx\n", hash);
+}
+
+// Draw agents visible by camera, interpolated between their two last positions, using sprite sheet frames
+// NOTE: Sprite sheet rows are directions [down, left, right, up, idle], columns are animation frames,
+// all visible agents are added to the same batch, no draw call per agent
+// If visibility is provided, only agents in visible cells are drawn
+void DrawMazeAgents(MazeAgents agents, Texture texSprite, Vector2 frameSize, Vector2 position, float alpha, Camera2D camera, Color tint, const MazeVisibility *visibility)
+{
+    if ((agents.count == 0) || (texSprite.id == 0)) return;
+
+    Rectangle view = GetCameraViewArea(camera);
+
+    // Frame size in normalized texture coordinates
+    float frameWidth = frameSize.x/texSprite.width;
+    float frameHeight = frameSize.y/texSprite.height;
+    float size = agents.size;
+
+    AddProfileCount(PROFILE_AGENT_BATCHES, 1);
+    rlSetTexture(texSprite.id);
+    rlBegin(RL_QUADS);
+
+        rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+        rlNormal3f(0.0f, 0.0f, 1.0f);
+
+        for (int i = 0; i < agents.count; i++)
+        {
+            float left = position.x + agents.previousX[i] + (agents.positionX[i] - agents.previousX[i])*alpha;
+            float top = position.y + agents.previousY[i] + (agents.positionY[i] - agents.previousY[i])*alpha;
+
+            if (((left + size) < view.x) || ((top + size) < view.y) || (left > (view.x + view.width)) || (top > (view.y + view.height))) continue;
+
+            if ((visibility != NULL) && !IsMazeCellVisible(*visibility,
+                (int)floorf((agents.positionX[i] + size/2.0f)/MAZE_SCALE), (int)floorf((agents.positionY[i] + size/2.0f)/MAZE_SCALE))) continue;
+
+            // Direction row from velocity main axis, same rows as player
+            float velocityX = agents.velocityX[i];
+            float velocityY = agents.velocityY[i];
+            int row = 4;
+
+            if ((velocityX != 0.0f) || (velocityY != 0.0f))
+            {
+                if (fabsf(velocityY) >= fabsf(velocityX)) row = (velocityY < 0.0f)? 3 : 0;
+                else row = (velocityX < 0.0f)? 1 : 2;
+            }
+
+            float u = agents.frames[i]*frameWidth;
+            float v = row*frameHeight;
+
+            // Make sure there is space in current batch for another quad,
+            // if not, batch is drawn and a new one started with same texture
+            if (rlCheckRenderBatchLimit(4)) AddProfileCount(PROFILE_AGENT_BATCHES, 1);
+
+            rlTexCoord2f(u, v);
+            rlVertex2f(left, top);
+
+            rlTexCoord2f(u, v + frameHeight);
+            rlVertex2f(left, top + size);
+
+            rlTexCoord2f(u + frameWidth, v + frameHeight);
+            rlVertex2f(left + size, top + size);
+
+            rlTexCoord2f(u + frameWidth, v);
+            rlVertex2f(left + size, top);
+        }
+
+    rlEnd();
+    rlSetTexture(0);
+}
+
+// Edit maze cell kind, registering changed cell in dirty region and updating distance fields
+void EditMazeCell(MazeLevel *level, Point cell, MazeCell kind)
+{
+    MazeGrid *grid = &level->grid;
+    MazeDirtyRegion *region = &level->dirty;
+
+    if ((cell.x < 0) || (cell.y < 0) || (cell.x >= grid->width) || (cell.y >= grid->height)) return;
+
+    // Nothing to do if cell does not change (i.e. mouse button held over same cell)
+    if (GetMazeCell(*grid, cell.x, cell.y) == kind) return;
+
+    SetMazeCell(grid, cell.x, cell.y, kind);
+
+    // Only walls change distances, fields are updated incrementally around the cell
+    UpdateMazeDistanceField(&level->exitField, *grid, cell);
+    UpdateMazeDistanceField(&level->startField, *grid, cell);
+    UpdateMazeDistanceField(&level->chaseField, *grid, cell);
+
+    AddMazeDirtyRegion(region, cell.x, cell.y, cell.x, cell.y);
+}
+
+// Update level data derived from cells (items, distance fields, dirty region) for a batch of edited cells
+// NOTE: Grid cells are already changed, items store follows item cells
+void ApplyMazeEditBatch(MazeLevel *level, MazeItems *items, MazeEditJournal *journal, MazeEditBatch batch)
+{
+    if (batch.runCount == 0) return;
+
+    int width = level->grid.width;
+
+    for (int r = 0; r < batch.runCount; r++)
+    {
+        // Undone runs are processed in reverse order, same order cells were changed
+        MazeEditRun run = batch.runs[batch.undo? (batch.runCount - 1 - r) : r];
+        MazeCell previous = (MazeCell)(batch.undo? run.after : run.before);
+        MazeCell current = (MazeCell)(batch.undo? run.before : run.after);
+
+        if ((previous == MAZE_CELL_ITEM) || (current == MAZE_CELL_ITEM))
+        {
+            for (int i = run.index; i < (run.index + run.length); i++)
+            {
+                Point cell = { i%width, i/width };
+
+                if (previous == MAZE_CELL_ITEM) RemoveMazeItem(items, cell, NULL);
+                if (current == MAZE_CELL_ITEM) AddMazeItem(items, cell, MAZE_ITEM_VALUE);
+            }
+        }
+    }
+
+    MazeDistanceField *fields[3] = { &level->exitField, &level->startField, &level->chaseField };
+
+    UpdateMazeEditBatch(journal, batch, level->grid, &level->dirty, fields, 3);
+}
+
+// Load fog texture (one pixel per cell), all cells unexplored
+Texture LoadFogTexture(int width, int height)
+{
+    Image imFog = GenImageColor(width, height, RAYWHITE);
+    Texture texFog = LoadTextureFromImage(imFog);
+    UnloadImage(imFog);
+
+    return texFog;
+}
+
+// Update fog texture with dirty region cells only: unexplored cells opaque, explored cells shaded, visible cells clear
+// NOTE: Unexplored cells get background color, explored cells shade matches darkened tiles
+void UpdateFogTexture(Texture texFog, MazeVisibility visibility, MazeDirtyRegion *region)
+{
+    if (!region->dirty || (visibility.visible == NULL)) return;
+
+    int width = region->maxX - region->minX + 1;
+    int height = region->maxY - region->minY + 1;
+    Rectangle rec = { (float)region->minX, (float)region->minY, (float)width, (float)height };
+
+    // Convert region cells into fog colors, in a contiguous buffer,
+    // regions around player view (i.e. player entering a new cell) use stack memory
+    Color stackPixels[1024];
+    Color *regionPixels = ((width*height) <= 1024)? stackPixels : (Color *)malloc(width*height*sizeof(Color));
+
+    for (int y = 0; y < height; y++)
+    {
+        for (int x = 0; x < width; x++)
+        {
+            int cellX = region->minX + x;
+            int cellY = region->minY + y;
+
+            if (IsMazeCellVisible(visibility, cellX, cellY)) regionPixels[y*width + x] = BLANK;
+            else if (IsMazeCellExplored(visibility, cellX, cellY)) regionPixels[y*width + x] = (Color){ 0, 0, 0, 255 - MAZE_EXPLORED_SHADE };
+            else regionPixels[y*width + x] = RAYWHITE;
+        }
+    }
+
+    UpdateTextureRec(texFog, rec, regionPixels);
+
+    if (regionPixels != stackPixels) free(regionPixels);
+
+    region->dirty = false;
+}
+
+// Draw maze minimap in screen space from maze texture and fog texture, with player marker and camera view area (in cells)
+// NOTE: Maze and fog textures (one pixel per cell) are kept updated with changed cells only,
+// so minimap is two quads, same cost whatever the maze size
+void DrawMazeMinimap(Texture texMaze, Texture texFog, Rectangle bounds, Vector2 playerCell, Rectangle viewCells)
+{
+    // Fit maze in bounds keeping aspect ratio, aligned to bounds bottom-right corner
+    float scale = fminf(bounds.width/texMaze.width, bounds.height/texMaze.height);
+    Rectangle map = {
+        bounds.x + bounds.width - texMaze.width*scale,
+        bounds.y + bounds.height - texMaze.height*scale,
+        texMaze.width*scale,
+        texMaze.height*scale
+    };
+
+    DrawTexturePro(texMaze, (Rectangle){ 0, 0, (float)texMaze.width, (float)texMaze.height }, map, (Vector2){ 0, 0 }, 0.0f, WHITE);
+    DrawTexturePro(texFog, (Rectangle){ 0, 0, (float)texFog.width, (float)texFog.height }, map, (Vector2){ 0, 0 }, 0.0f, WHITE);
+    DrawRectangleLinesEx(map, 2.0f, DARKGRAY);
+
+    // Camera view area, clipped to minimap
+    float left = fmaxf(map.x, map.x + viewCells.x*scale);
+    float top = fmaxf(map.y, map.y + viewCells.y*scale);
+    float right = fminf(map.x + map.width, map.x + (viewCells.x + viewCells.width)*scale);
+    float bottom = fminf(map.y + map.height, map.y + (viewCells.y + viewCells.height)*scale);
+
+    if ((right > left) && (bottom > top)) DrawRectangleLinesEx((Rectangle){ left, top, right - left, bottom - top }, 1.0f, YELLOW);
+
+    DrawCircleV((Vector2){ map.x + playerCell.x*scale, map.y + playerCell.y*scale }, fmaxf(2.0f, scale), BLUE);
+}
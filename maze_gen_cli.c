@@ -0,0 +1,336 @@
+/*******************************************************************************************
+*
+*   raylib maze game - Headless batch maze generator
+*
+*   Generates a batch of mazes without window, GPU or audio device, saving them to disk
+*   and reporting generation time, throughput and peak memory for every maze
+*
+*   Peak memory (peak_mb) is the process peak resident memory while the maze is generated,
+*   validated, analyzed and saved: peak is reset before every maze on Linux (/proc/self/clear_refs),
+*   on other systems it can not be reset and it is the process peak so far (n/a on Windows)
+*
+*   Streamed generation (Eller's algorithm only) never keeps the whole maze in memory,
+*   rows are saved as generated (PGM image), so mazes of any height can be generated
+*
+*   USAGE: maze_gen [options]
+*       --width <cells>         Maze width (default: 64)
+*       --height <cells>        Maze height (default: 64)
+*       --algorithm <name>      Generation algorithm: grid, backtracker, wilson, eller (default: grid)
+*       --spacing <cells>       Grid algorithm points spacing, rows and columns (default: 4)
+*       --chance <0.0..1.0>     Grid algorithm point chance (default: 0.75)
+*       --seed <seed>           First maze seed, next mazes use seed + index (default: 67218)
+*       --count <mazes>         Number of mazes to generate (default: 1)
+*       --threads <threads>     Generation threads (grid algorithm), 0 = all hardware threads (default: 0)
+*       --output <directory>    Directory to save mazes as PNG (PGM if streamed) (default: current directory)
+*       --stream                Stream maze rows (eller algorithm only), --validate and --stats not available
+*       --no-output             Do not save mazes, only benchmark generation
+*       --validate              Check exit (width-2, height-2) is reachable from start (1, 1)
+*       --stats                 Analyze mazes: wall ratio, dead ends, junctions, corridors, regions
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include "maze_grid.h"      // Required for: MazeGrid, GenMazeGridEx(), GenMazeGridRows(), GenImageFromMazeGrid()
+#include "maze_path.h"      // Required for: LoadMazeDistanceField(), GetMazeDistance()
+#include "maze_stats.h"     // Required for: MazeStats, GetMazeStats()
+#include "maze_jobs.h"      // Required for: InitMazeJobs(), CloseMazeJobs()
+#include "maze_profiler.h"  // Required for: GetMazeTime()
+
+#include <stdio.h>          // Required for: printf(), fprintf(), fopen(), fwrite(), fclose(), fgets(), sscanf()
+#include <stdlib.h>         // Required for: atoi(), atof(), strtoul()
+#include <string.h>         // Required for: strcmp()
+
+#if !defined(_WIN32)
+    #include <sys/resource.h>   // Required for: getrusage()
+#endif
+
+// Streamed maze rows output, walls counted so rows are always consumed
+typedef struct MazeRowsOutput {
+    FILE *file;                 // PGM image file, NULL if rows are not saved
+    long long wallCount;
+} MazeRowsOutput;
+
+// Save streamed maze row to PGM image (if any), counting walls (row callback)
+// NOTE: PGM pixels are one byte per cell, rows saved in order, same colors than PNG output
+static void WriteMazeRow(const unsigned char *cells, int width, int y, void *userData)
+{
+    MazeRowsOutput *output = (MazeRowsOutput *)userData;
+    unsigned char pixels[1024];
+
+    (void)y;
+
+    for (int x = 0; x < width; x += 1024)
+    {
+        int count = ((width - x) < 1024)? (width - x) : 1024;
+
+        for (int i = 0; i < count; i++)
+        {
+            output->wallCount += (cells[x + i] == MAZE_CELL_WALL);
+            pixels[i] = GetMazeCellColor((MazeCell)cells[x + i]).r;
+        }
+
+        if (output->file != NULL) fwrite(pixels, 1, count, output->file);
+    }
+}
+
+// Reset process peak resident memory to current resident memory, returns false if not supported
+static bool ResetPeakMemory(void)
+{
+#if defined(__linux__)
+    FILE *file = fopen("/proc/self/clear_refs", "w");
+    if (file == NULL) return false;
+
+    bool reset = (fputs("5", file) >= 0);   // 5: Reset peak resident memory (VmHWM)
+    if (fclose(file) != 0) reset = false;
+
+    return reset;
+#else
+    return false;
+#endif
+}
+
+// Get process peak resident memory in bytes, since last ResetPeakMemory() if supported, 0 if not available
+static long long GetPeakMemory(void)
+{
+#if defined(__linux__)
+    // NOTE: getrusage() peak is never reset, VmHWM is reset by ResetPeakMemory()
+    FILE *file = fopen("/proc/self/status", "r");
+
+    if (file != NULL)
+    {
+        char line[256] = { 0 };
+        long long peakKb = 0;
+
+        while ((fgets(line, sizeof(line), file) != NULL) && (sscanf(line, "VmHWM: %lld kB", &peakKb) != 1)) { }
+
+        fclose(file);
+
+        if (peakKb > 0) return peakKb*1024;
+    }
+#endif
+#if !defined(_WIN32)
+    struct rusage usage = { 0 };
+    getrusage(RUSAGE_SELF, &usage);
+
+  #if defined(__APPLE__)
+    return (long long)usage.ru_maxrss;          // Bytes on macOS
+  #else
+    return (long long)usage.ru_maxrss*1024;     // Kilobytes on Linux
+  #endif
+#else
+    return 0;
+#endif
+}
+
+// Print maze peak memory CSV column (megabytes) ending maze row, keeping batch peak
+static void PrintPeakMemory(long long *batchPeakMemory)
+{
+    long long peakMemory = GetPeakMemory();
+
+    if (peakMemory > *batchPeakMemory) *batchPeakMemory = peakMemory;
+
+    if (peakMemory > 0) printf(",%.2f\n", (double)peakMemory/(1024.0*1024.0));
+    else printf(",n/a\n");
+}
+
+//----------------------------------------------------------------------------------
+// Main entry point
+//----------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    int width = 64;
+    int height = 64;
+    MazeGenAlgorithm algorithm = MAZE_GEN_GRID;
+    int spacing = 4;
+    float pointChance = 0.75f;
+    unsigned int seed = 67218;
+    int count = 1;
+    int threads = 0;
+    const char *outputDir = ".";
+    bool saveOutput = true;
+    bool validate = false;
+    bool analyze = false;
+    bool stream = false;
+
+    // Parse command line options
+    for (int i = 1; i < argc; i++)
+    {
+        bool hasValue = (i + 1) < argc;
+
+        if ((strcmp(argv[i], "--width") == 0) && hasValue) width = atoi(argv[++i]);
+        else if ((strcmp(argv[i], "--algorithm") == 0) && hasValue)
+        {
+            const char *name = argv[++i];
+
+            algorithm = MAZE_GEN_ALGORITHMS;
+            for (int a = 0; a < MAZE_GEN_ALGORITHMS; a++) if (strcmp(name, GetMazeGenAlgorithmName(a)) == 0) algorithm = a;
+
+            if (algorithm == MAZE_GEN_ALGORITHMS)
+            {
+                fprintf(stderr, "Unknown algorithm: %s (grid, backtracker, wilson, eller)\n", name);
+                return 1;
+            }
+        }
+        else if ((strcmp(argv[i], "--height") == 0) && hasValue) height = atoi(argv[++i]);
+        else if ((strcmp(argv[i], "--spacing") == 0) && hasValue) spacing = atoi(argv[++i]);
+        else if ((strcmp(argv[i], "--chance") == 0) && hasValue) pointChance = (float)atof(argv[++i]);
+        else if ((strcmp(argv[i], "--seed") == 0) && hasValue) seed = (unsigned int)strtoul(argv[++i], NULL, 10);
+        else if ((strcmp(argv[i], "--count") == 0) && hasValue) count = atoi(argv[++i]);
+        else if ((strcmp(argv[i], "--threads") == 0) && hasValue) threads = atoi(argv[++i]);
+        else if ((strcmp(argv[i], "--output") == 0) && hasValue) outputDir = argv[++i];
+        else if (strcmp(argv[i], "--no-output") == 0) saveOutput = false;
+        else if (strcmp(argv[i], "--validate") == 0) validate = true;
+        else if (strcmp(argv[i], "--stats") == 0) analyze = true;
+        else if (strcmp(argv[i], "--stream") == 0) stream = true;
+        else
+        {
+            fprintf(stderr, "Unknown or incomplete option: %s\n", argv[i]);
+            fprintf(stderr, "USAGE: %s [--width w] [--height h] [--algorithm a] [--spacing s] [--chance c] [--seed s] [--count n] [--threads t] [--output dir] [--no-output] [--validate] [--stats] [--stream]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    if ((width < 3) || (height < 3) || (spacing < 1) || (count < 1))
+    {
+        fprintf(stderr, "Invalid maze parameters: width and height must be >= 3, spacing and count >= 1\n");
+        return 1;
+    }
+
+    if (stream && ((algorithm != MAZE_GEN_ELLER) || validate || analyze))
+    {
+        fprintf(stderr, "Streamed generation requires eller algorithm, without --validate or --stats\n");
+        return 1;
+    }
+
+    SetTraceLogLevel(LOG_WARNING);      // Avoid raylib info logs on every image export
+    InitMazeJobs(threads);              // Workers launched once, for all mazes
+
+    double cellsPerMaze = (double)width*height;
+    double totalTime = 0.0;
+    int unreachableCount = 0;
+    long long batchPeakMemory = 0;
+
+    // CSV columns, optional columns in options order
+    printf("maze,seed,algorithm,width,height,gen_ms,cells_per_s");
+    if (validate) printf(",reachable,path_length,validate_ms");
+    if (analyze) printf(",wall_ratio,dead_ends,junctions,corridors,corridor_mean,corridor_max,item_density,components,largest_component,stats_ms");
+    printf(",peak_mb\n");
+
+    for (int i = 0; i < count; i++)
+    {
+        unsigned int mazeSeed = seed + (unsigned int)i;
+
+        ResetPeakMemory();
+
+        if (stream)
+        {
+            // Rows saved while generated, generation time includes saving
+            MazeRowsOutput output = { 0 };
+
+            if (saveOutput)
+            {
+                output.file = fopen(TextFormat("%s/maze_%05i.pgm", outputDir, i), "wb");
+
+                if (output.file == NULL) fprintf(stderr, "Maze %i could not be saved to: %s\n", i, outputDir);
+                else fprintf(output.file, "P5\n%i %i\n255\n", width, height);
+            }
+
+            double startTime = GetMazeTime();
+            bool generated = GenMazeGridRows(width, height, mazeSeed, WriteMazeRow, &output);
+            double genTime = GetMazeTime() - startTime;
+
+            if (output.file != NULL) fclose(output.file);
+
+            if (!generated)
+            {
+                fprintf(stderr, "Maze %i could not be generated (out of memory?)\n", i);
+                return 1;
+            }
+
+            totalTime += genTime;
+
+            printf("%i,%u,%s,%i,%i,%.3f,%.0f", i, mazeSeed, GetMazeGenAlgorithmName(algorithm), width, height, genTime*1000.0, (genTime > 0.0)? cellsPerMaze/genTime : 0.0);
+            PrintPeakMemory(&batchPeakMemory);
+            continue;
+        }
+
+        MazeGenConfig config = { algorithm, mazeSeed, spacing, spacing, pointChance, threads };
+
+        double startTime = GetMazeTime();
+        MazeGrid grid = GenMazeGridEx(width, height, config);
+        double genTime = GetMazeTime() - startTime;
+
+        if (grid.cells == NULL)
+        {
+            fprintf(stderr, "Maze %i could not be generated (out of memory?)\n", i);
+            return 1;
+        }
+
+        totalTime += genTime;
+
+        printf("%i,%u,%s,%i,%i,%.3f,%.0f", i, mazeSeed, GetMazeGenAlgorithmName(algorithm), width, height, genTime*1000.0, (genTime > 0.0)? cellsPerMaze/genTime : 0.0);
+
+        if (validate)
+        {
+            // Distance field from exit cell, start cell distance is the shortest path length
+            startTime = GetMazeTime();
+            MazeDistanceField exitField = LoadMazeDistanceField(grid, (Point){ width - 2, height - 2 });
+            unsigned int pathLength = GetMazeDistance(exitField, 1, 1);
+            double validateTime = GetMazeTime() - startTime;
+
+            if (pathLength == MAZE_DISTANCE_UNREACHABLE)
+            {
+                unreachableCount++;
+                printf(",0,-1,%.3f", validateTime*1000.0);
+            }
+            else printf(",1,%u,%.3f", pathLength, validateTime*1000.0);
+
+            UnloadMazeDistanceField(exitField);
+        }
+
+        if (analyze)
+        {
+            startTime = GetMazeTime();
+            MazeStats stats = GetMazeStats(grid, threads);
+            double statsTime = GetMazeTime() - startTime;
+
+            printf(",%.4f,%i,%i,%i,%.3f,%i,%.4f,%i,%i,%.3f", stats.wallRatio, stats.deadEndCount, stats.junctionCount,
+                stats.corridorCount, stats.corridorMeanLength, stats.corridorMaxLength, stats.itemDensity,
+                stats.componentCount, stats.largestComponent, statsTime*1000.0);
+        }
+
+        if (saveOutput)
+        {
+            Image image = GenImageFromMazeGrid(grid);
+
+            if (!ExportImage(image, TextFormat("%s/maze_%05i.png", outputDir, i)))
+            {
+                fprintf(stderr, "Maze %i could not be saved to: %s\n", i, outputDir);
+            }
+
+            UnloadImage(image);
+        }
+
+        UnloadMazeGrid(grid);
+
+        PrintPeakMemory(&batchPeakMemory);     // Maze grid and scratch memory released, peak kept
+    }
+
+    CloseMazeJobs();
+
+    // Batch summary
+    printf("\n");
+    printf("mazes: %i\n", count);
+    printf("total_gen_s: %.3f\n", totalTime);
+    printf("avg_gen_ms: %.3f\n", totalTime*1000.0/count);
+    printf("cells_per_s: %.0f\n", (totalTime > 0.0)? cellsPerMaze*count/totalTime : 0.0);
+    if (validate) printf("unreachable: %i\n", unreachableCount);
+
+    if (batchPeakMemory > 0) printf("peak_memory_mb: %.2f\n", (double)batchPeakMemory/(1024.0*1024.0));
+    else printf("peak_memory_mb: n/a\n");
+
+    return 0;
+}
@@ -0,0 +1,781 @@
+/*******************************************************************************************
+*
+*   maze_grid - Compact maze cells grid, used as the maze model
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "maze_grid.h"
+#include "maze_jobs.h"      // Required for: RunMazeJobs()
+
+#include <stdlib.h>     // Required for: malloc(), calloc(), free()
+#include <string.h>     // Required for: memset(), memcpy(), strcmp()
+
+#define MAZE_GEN_STREAM     0x6d617a65ULL   // Random stream of perfect maze algorithms (plus algorithm), grid bands use band index
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+// Display colors for every cell kind
+// NOTE: Color scheme used: WHITE = Wall, BLACK = Walkable, RED = Item, GREEN = Exit
+static const Color mazeCellColors[MAZE_CELL_KINDS] = {
+    { 0, 0, 0, 255 },           // MAZE_CELL_FLOOR: BLACK
+    { 255, 255, 255, 255 },     // MAZE_CELL_WALL: WHITE
+    { 230, 41, 55, 255 },       // MAZE_CELL_ITEM: RED
+    { 0, 228, 48, 255 },        // MAZE_CELL_EXIT: GREEN
+};
+
+// Generation algorithms names, also used as command line values
+static const char *mazeGenAlgorithmNames[MAZE_GEN_ALGORITHMS] = { "grid", "backtracker", "wilson", "eller" };
+
+// Room to room directions: East, West, South, North, opposite direction is (direction ^ 1)
+// NOTE: Rooms are 2 cells away, the cell in between is the wall removed to connect them
+static const int roomStepsX[4] = { 1, -1, 0, 0 };
+static const int roomStepsY[4] = { 0, 0, 1, -1 };
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Parallel generation data, shared by all bands
+typedef struct MazeGenBands {
+    MazeGrid grid;
+    int spacingRows;
+    int spacingCols;
+    int pointThreshold;         // Point chance, scaled to [0..100]
+    unsigned int seed;
+    int pointCols;              // Points per point row
+    int bandCount;
+    int *points;                // Points (cell index) of all bands, every band uses its own slice
+    int *continuations;         // Lines clipped at band edges: cell index + direction pairs
+    int *continuationCounts;    // Lines clipped per band
+} MazeGenBands;
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Declaration
+//----------------------------------------------------------------------------------
+static int GetMazeMaxPoints(int width, int height, int spacingRows, int spacingCols);  // Get max points for grid size and spacing
+static void GenMazeGridCells(MazeGrid grid, int *mazePoints, int spacingRows, int spacingCols, float pointChance);  // Generate maze cells, grid cells must be walkable
+static int GetBandPointsOffset(const MazeGenBands *bands, int band);   // Get band first point slot
+static void GenMazeGridBand(void *data, int band);                      // Generate one band of maze (job)
+static unsigned long long GetMazeRandomBits(MazeRandom *rng);          // Get 64 random bits (SplitMix64 step)
+static bool GenMazeGridBands(MazeGrid grid, int spacingRows, int spacingCols, float pointChance, unsigned int seed, int threadCount);  // Generate grid algorithm maze in parallel bands, grid cells must be walkable
+static void GenMazeBacktracker(MazeGrid grid, unsigned int seed);      // Generate perfect maze with recursive backtracker
+static void GenMazeWilson(MazeGrid grid, unsigned int seed);           // Generate perfect maze with Wilson's algorithm
+static void ExtendMazeRooms(MazeGrid grid);                            // Copy last rooms column and row to spare column and row of even sized grids
+static void CopyMazeGridRow(const unsigned char *cells, int width, int y, void *userData);  // Copy streamed row into grid (row callback)
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Load maze grid, all cells set to floor
+MazeGrid LoadMazeGrid(int width, int height)
+{
+    MazeGrid grid = { 0 };
+
+    if ((width > 0) && (height > 0))
+    {
+        grid.cells = (unsigned char *)calloc((size_t)width*height, sizeof(unsigned char));
+
+        if (grid.cells != NULL)
+        {
+            grid.width = width;
+            grid.height = height;
+        }
+    }
+
+    return grid;
+}
+
+// Unload maze grid from memory (RAM)
+void UnloadMazeGrid(MazeGrid grid)
+{
+    free(grid.cells);
+}
+
+// Generate procedural maze grid, using grid-based algorithm
+// NOTE: Working memory is sized to the number of maze points, all steps run linearly
+// in the number of cells, writing directly into the grid cells buffer
+MazeGrid GenMazeGrid(int width, int height, int spacingRows, int spacingCols, float pointChance)
+{
+    // STEP 1.1: Load grid with all cells walkable
+    MazeGrid grid = LoadMazeGrid(width, height);
+
+    if ((grid.cells == NULL) || (spacingRows <= 0) || (spacingCols <= 0)) return grid;
+
+    // Points array allocated for the max number of points possible for this grid size and spacing
+    int maxPoints = GetMazeMaxPoints(width, height, spacingRows, spacingCols);
+    int *mazePoints = (maxPoints > 0)? (int *)malloc((size_t)maxPoints*sizeof(int)) : NULL;
+
+    GenMazeGridCells(grid, mazePoints, spacingRows, spacingCols, pointChance);
+
+    free(mazePoints);
+
+    return grid;
+}
+
+// Generate procedural maze grid, using grid-based algorithm, with all memory taken from arena
+// NOTE: Grid cells stay in arena (freed on arena reset), points working memory is freed before returning
+MazeGrid GenMazeGridArena(MazeArena *arena, int width, int height, int spacingRows, int spacingCols, float pointChance)
+{
+    MazeGrid grid = { 0 };
+
+    if ((width <= 0) || (height <= 0)) return grid;
+
+    grid.cells = (unsigned char *)AllocMazeArena(arena, (size_t)width*height);
+
+    if (grid.cells == NULL) return grid;
+
+    grid.width = width;
+    grid.height = height;
+    memset(grid.cells, MAZE_CELL_FLOOR, (size_t)width*height);
+
+    if ((spacingRows <= 0) || (spacingCols <= 0)) return grid;
+
+    size_t arenaMark = arena->used;
+    int maxPoints = GetMazeMaxPoints(width, height, spacingRows, spacingCols);
+    int *mazePoints = (int *)AllocMazeArena(arena, (size_t)maxPoints*sizeof(int));
+
+    if ((maxPoints > 0) && (mazePoints == NULL))
+    {
+        // Not enough arena space for working memory, use heap memory as fallback
+        mazePoints = (int *)malloc((size_t)maxPoints*sizeof(int));
+        GenMazeGridCells(grid, mazePoints, spacingRows, spacingCols, pointChance);
+        free(mazePoints);
+    }
+    else GenMazeGridCells(grid, mazePoints, spacingRows, spacingCols, pointChance);
+
+    arena->used = arenaMark;    // Points working memory not required any more
+
+    return grid;
+}
+
+// Generate procedural maze grid in parallel bands, same result for a seed whatever threadCount is used
+// NOTE: Same grid-based algorithm than GenMazeGrid(), but every band of MAZE_GEN_BAND_ROWS rows
+// places, shuffles and draws its own points with its own random stream; lines are clipped to
+// their band and the lines reaching a band edge are continued afterwards, in band order
+MazeGrid GenMazeGridParallel(int width, int height, int spacingRows, int spacingCols, float pointChance, unsigned int seed, int threadCount)
+{
+    MazeGrid grid = LoadMazeGrid(width, height);
+
+    if ((grid.cells == NULL) || (spacingRows <= 0) || (spacingCols <= 0)) return grid;
+
+    GenMazeGridBands(grid, spacingRows, spacingCols, pointChance, seed, threadCount);
+
+    return grid;
+}
+
+// Generate procedural maze grid, using config algorithm
+MazeGrid GenMazeGridEx(int width, int height, MazeGenConfig config)
+{
+    MazeGrid grid = LoadMazeGrid(width, height);
+
+    if ((grid.cells != NULL) && !FillMazeGrid(grid, config))
+    {
+        UnloadMazeGrid(grid);
+        grid = (MazeGrid){ 0 };
+    }
+
+    return grid;
+}
+
+// Fill grid cells with a generated maze, grid memory can be any (heap, arena, file)
+// NOTE: All previous cells are overwritten, returns false if working memory could not be allocated
+bool FillMazeGrid(MazeGrid grid, MazeGenConfig config)
+{
+    if ((grid.cells == NULL) || (grid.width <= 0) || (grid.height <= 0)) return false;
+
+    bool success = true;
+
+    switch (config.algorithm)
+    {
+        case MAZE_GEN_GRID:
+        {
+            memset(grid.cells, MAZE_CELL_FLOOR, (size_t)grid.width*grid.height);
+
+            if ((config.spacingRows > 0) && (config.spacingCols > 0))
+            {
+                success = GenMazeGridBands(grid, config.spacingRows, config.spacingCols, config.pointChance, config.seed, config.threadCount);
+            }
+        } break;
+        case MAZE_GEN_BACKTRACKER: GenMazeBacktracker(grid, config.seed); break;
+        case MAZE_GEN_WILSON: GenMazeWilson(grid, config.seed); break;
+        case MAZE_GEN_ELLER:
+        {
+            success = GenMazeGridRows(grid.width, grid.height, config.seed, CopyMazeGridRow, &grid);
+        } break;
+        default: success = false; break;
+    }
+
+    return success;
+}
+
+// Generate maze with Eller's algorithm, streamed row by row, from top to bottom
+// NOTE: Only two rows of cells and two links per room column are kept, so working memory
+// is O(width) whatever maze height; every set of rooms connected through previous rows is
+// kept as a circular list of its current row rooms (sorted by column, sets never cross),
+// so checking and merging sets are constant time
+bool GenMazeGridRows(int width, int height, unsigned int seed, MazeRowCallback callback, void *userData)
+{
+    if ((width <= 0) || (height <= 0) || (callback == NULL)) return false;
+
+    int roomCols = (width - 1)/2;
+    int roomRows = (height - 1)/2;
+
+    unsigned char *roomRow = (unsigned char *)malloc((size_t)width*2);
+    int *links = (int *)malloc(((size_t)roomCols + 1)*2*sizeof(int));
+
+    if ((roomRow == NULL) || (links == NULL))
+    {
+        free(roomRow);
+        free(links);
+        return false;
+    }
+
+    unsigned char *wallRow = roomRow + width;
+    int *left = links;                  // Previous room of same set, by room column
+    int *right = links + roomCols + 1;  // Next room of same set, by room column
+    MazeRandom rng = InitMazeRandom(seed, MAZE_GEN_STREAM + MAZE_GEN_ELLER);
+    unsigned long long randomBits = 0;     // Random decisions taken one bit at a time, 64 bits per random value
+    int randomBitCount = 0;
+    int y = 0;
+
+    // Grid top border, also whole grid if there are no rooms
+    memset(roomRow, MAZE_CELL_WALL, width);
+    callback(roomRow, width, y++, userData);
+
+    for (int i = 0; i < roomCols; i++)
+    {
+        left[i] = i;
+        right[i] = i;
+    }
+
+    for (int r = 0; (r < roomRows) && (roomCols > 0); r++)
+    {
+        bool lastRow = (r == (roomRows - 1));
+
+        memset(roomRow, MAZE_CELL_WALL, width);
+        memset(wallRow, MAZE_CELL_WALL, width);
+
+        for (int i = 0; i < roomCols; i++)
+        {
+            int x = 2*i + 1;
+
+            roomRow[x] = MAZE_CELL_FLOOR;
+
+            // Join right room if in a different set (next room of same set would be the right one),
+            // last row joins all sets, so all rooms are connected
+            if (randomBitCount < 2)
+            {
+                randomBits = GetMazeRandomBits(&rng);
+                randomBitCount = 64;
+            }
+
+            bool joinRight = (randomBits & 1);
+            bool goDown = (randomBits & 2);
+            randomBits >>= 2;
+            randomBitCount -= 2;
+
+            if ((i < (roomCols - 1)) && (right[i] != (i + 1)) && (lastRow || joinRight))
+            {
+                right[left[i + 1]] = right[i];
+                left[right[i]] = left[i + 1];
+                right[i] = i + 1;
+                left[i + 1] = i;
+
+                roomRow[x + 1] = MAZE_CELL_FLOOR;
+            }
+
+            if (lastRow) continue;
+
+            // Room goes down unless removed from its set (next row room starts a new set),
+            // only rooms not alone in their set can be removed, so every set goes down
+            if ((right[i] != i) && !goDown)
+            {
+                left[right[i]] = left[i];
+                right[left[i]] = right[i];
+                left[i] = i;
+                right[i] = i;
+            }
+            else wallRow[x] = MAZE_CELL_FLOOR;
+        }
+
+        // Even width: last rooms column is 2 cells wide
+        if ((width%2) == 0)
+        {
+            roomRow[width - 2] = roomRow[width - 3];
+            wallRow[width - 2] = wallRow[width - 3];
+        }
+
+        callback(roomRow, width, y++, userData);
+        if (!lastRow) callback(wallRow, width, y++, userData);
+    }
+
+    // Even height: last rooms row is 2 cells tall
+    if (((height%2) == 0) && (roomCols > 0) && (roomRows > 0)) callback(roomRow, width, y++, userData);
+
+    // Grid bottom border (and rows without rooms)
+    memset(roomRow, MAZE_CELL_WALL, width);
+    while (y < height) callback(roomRow, width, y++, userData);
+
+    free(roomRow);
+    free(links);
+
+    return true;
+}
+
+// Get algorithm name (grid, backtracker, wilson, eller)
+const char *GetMazeGenAlgorithmName(MazeGenAlgorithm algorithm)
+{
+    return (((unsigned int)algorithm) < MAZE_GEN_ALGORITHMS)? mazeGenAlgorithmNames[algorithm] : "unknown";
+}
+
+// Init random generator for a seed and stream
+// NOTE: Different streams of the same seed generate independent sequences
+MazeRandom InitMazeRandom(unsigned long long seed, unsigned long long stream)
+{
+    MazeRandom rng = { seed ^ (stream*0xd1342543de82ef95ULL) };
+
+    GetMazeRandomValue(&rng, 0, 1);     // Discard first value, mixing seed and stream bits
+
+    return rng;
+}
+
+// Get random value between min and max (both included)
+int GetMazeRandomValue(MazeRandom *rng, int min, int max)
+{
+    unsigned long long z = GetMazeRandomBits(rng);
+
+    // Map upper 32 bits to range, multiply-shift avoids the modulo
+    unsigned long long range = (unsigned long long)((long long)max - min + 1);
+
+    return min + (int)(((z >> 32)*range) >> 32);
+}
+
+// Get display color for a cell kind
+Color GetMazeCellColor(MazeCell cell)
+{
+    return mazeCellColors[cell & 0x03];
+}
+
+// Generate image from maze grid (R8G8B8A8), for display
+Image GenImageFromMazeGrid(MazeGrid grid)
+{
+    Image image = GenImageColor(grid.width, grid.height, BLACK);
+    Color *pixels = (Color *)image.data;
+
+    for (int i = 0; i < grid.width*grid.height; i++) pixels[i] = mazeCellColors[grid.cells[i] & 0x03];
+
+    return image;
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+// Get 64 random bits (SplitMix64 step)
+static unsigned long long GetMazeRandomBits(MazeRandom *rng)
+{
+    unsigned long long z = (rng->state += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30))*0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27))*0x94d049bb133111ebULL;
+
+    return z ^ (z >> 31);
+}
+
+// Generate grid algorithm maze in parallel bands, grid cells must be walkable
+// NOTE: Same grid-based algorithm than GenMazeGrid(), but every band of MAZE_GEN_BAND_ROWS rows
+// places, shuffles and draws its own points with its own random stream; lines are clipped to
+// their band and the lines reaching a band edge are continued afterwards, in band order
+static bool GenMazeGridBands(MazeGrid grid, int spacingRows, int spacingCols, float pointChance, unsigned int seed, int threadCount)
+{
+    int width = grid.width;
+    int height = grid.height;
+
+    MazeGenBands bands = { 0 };
+    bands.grid = grid;
+    bands.spacingRows = spacingRows;
+    bands.spacingCols = spacingCols;
+    bands.pointThreshold = (int)(pointChance*100);
+    bands.seed = seed;
+    bands.pointCols = (width > 2)? (width - 2)/spacingCols : 0;
+    bands.bandCount = (height + MAZE_GEN_BAND_ROWS - 1)/MAZE_GEN_BAND_ROWS;
+
+    // Every band gets its own slice of points and line continuations buffers,
+    // sized for the max number of points of all point rows above it
+    int pointRows = (height > 2)? (height - 2)/spacingRows : 0;
+    size_t maxPoints = (size_t)bands.pointCols*pointRows;
+
+    bands.points = (int *)malloc((maxPoints + 1)*sizeof(int));
+    bands.continuations = (int *)malloc((maxPoints + 1)*2*sizeof(int));
+    bands.continuationCounts = (int *)calloc(bands.bandCount, sizeof(int));
+
+    if ((bands.points == NULL) || (bands.continuations == NULL) || (bands.continuationCounts == NULL))
+    {
+        free(bands.points);
+        free(bands.continuations);
+        free(bands.continuationCounts);
+        return false;
+    }
+
+    RunMazeJobs(GenMazeGridBand, &bands, bands.bandCount, threadCount);
+
+    // Continue lines clipped at band edges, sequentially in band order
+    for (int b = 0; b < bands.bandCount; b++)
+    {
+        const int *continuations = bands.continuations + 2*GetBandPointsOffset(&bands, b);
+
+        for (int i = 0; i < bands.continuationCounts[b]; i++)
+        {
+            int currentDir = continuations[2*i + 1];
+            unsigned char *nextCell = grid.cells + continuations[2*i];
+
+            while (*nextCell == MAZE_CELL_FLOOR)
+            {
+                *nextCell = MAZE_CELL_WALL;
+                nextCell += currentDir;
+            }
+        }
+    }
+
+    free(bands.points);
+    free(bands.continuations);
+    free(bands.continuationCounts);
+
+    return true;
+}
+
+// Get max points for grid size and spacing
+// NOTE: Points are only placed inside the border, at multiples of spacing
+static int GetMazeMaxPoints(int width, int height, int spacingRows, int spacingCols)
+{
+    int pointCols = (width > 2)? (width - 2)/spacingCols : 0;
+    int pointRows = (height > 2)? (height - 2)/spacingRows : 0;
+
+    return pointCols*pointRows;
+}
+
+// Generate maze cells, grid cells must be walkable
+// NOTE: mazePoints must have space for GetMazeMaxPoints() points
+static void GenMazeGridCells(MazeGrid grid, int *mazePoints, int spacingRows, int spacingCols, float pointChance)
+{
+    int width = grid.width;
+    int height = grid.height;
+
+    // STEP 1.2: Draw grid border, first and last rows are contiguous in memory
+    memset(grid.cells, MAZE_CELL_WALL, width);
+    memset(grid.cells + (size_t)(height - 1)*width, MAZE_CELL_WALL, width);
+
+    for (int y = 1; y < (height - 1); y++)
+    {
+        grid.cells[(size_t)y*width] = MAZE_CELL_WALL;
+        grid.cells[(size_t)y*width + width - 1] = MAZE_CELL_WALL;
+    }
+    //---------------------------------------------------------------------------------
+    
+    // STEP 2: Set some random point in grid at specific row-column distances
+    //---------------------------------------------------------------------------------
+    // STEP 2.1: Array of points used for maze generation (mazePoints), stored as cell index
+    if (GetMazeMaxPoints(width, height, spacingRows, spacingCols) == 0) return;
+
+    int mazePointCounter = 0;
+    
+    // STEP 2.2: Store specific points, at specific row-column distances
+    // NOTE: Only grid positions multiple of spacing are visited
+    int pointThreshold = (int)(pointChance*100);
+
+    for (int y = spacingRows; y < (height - 1); y += spacingRows)
+    {
+        for (int x = spacingCols; x < (width - 1); x += spacingCols)
+        {
+            if (GetRandomValue(0, 100) <= pointThreshold) 
+            {
+                mazePoints[mazePointCounter] = y*width + x;
+                mazePointCounter++;
+            }
+        }
+    }
+
+    // STEP 2.3: Draw our points in grid
+    for (int i = 0; i < mazePointCounter; i++) grid.cells[mazePoints[i]] = MAZE_CELL_WALL;
+    //---------------------------------------------------------------------------------
+
+    // STEP 3: Draw lines from every point in a random direction
+    //---------------------------------------------------------------------------------
+    // STEP 3.1: Define an array of 4 directions for convenience,
+    // as cell index offsets: East, West, South, North
+    int directions[4] = { 1, -1, width, -width };
+
+    // STEP 3.2: Shuffle points (Fisher-Yates), so we can access maze-points randomly,
+    // instead of following the order we stored them
+    // NOTE: LoadRandomSequence() rejects repeated values, getting quadratic for big mazes
+    for (int i = mazePointCounter - 1; i > 0; i--)
+    {
+        int j = GetRandomValue(0, i);
+        int temp = mazePoints[i];
+        mazePoints[i] = mazePoints[j];
+        mazePoints[j] = temp;
+    }
+
+    // STEP 3.3: Process every random maze point, drawing cells in one random direction,
+    // until we collision with another wall cell
+    // NOTE: Grid border is always wall, so lines never leave the grid
+    // and every cell is drawn once at most: total work is linear in cells count
+    for (int i = 0; i < mazePointCounter; i++) 
+    {
+        int currentDir = directions[GetRandomValue(0, 3)];
+        unsigned char *nextCell = grid.cells + mazePoints[i] + currentDir;
+        
+        while (*nextCell == MAZE_CELL_FLOOR)
+        {
+            *nextCell = MAZE_CELL_WALL;
+            nextCell += currentDir;
+        }
+    }
+}
+
+// Get band first point slot, counting point rows of previous bands
+static int GetBandPointsOffset(const MazeGenBands *bands, int band)
+{
+    // Point rows are placed at y = k*spacingRows, k >= 1, only inside the border
+    int firstRow = band*MAZE_GEN_BAND_ROWS;
+    int pointRowsBefore = (firstRow > 0)? (firstRow - 1)/bands->spacingRows : 0;
+    int maxPointRows = (bands->grid.height > 2)? (bands->grid.height - 2)/bands->spacingRows : 0;
+
+    if (pointRowsBefore > maxPointRows) pointRowsBefore = maxPointRows;
+
+    return pointRowsBefore*bands->pointCols;
+}
+
+// Generate one band of maze (job)
+// NOTE: Only cells of the band rows are read or written, bands can be processed concurrently
+static void GenMazeGridBand(void *data, int band)
+{
+    MazeGenBands *bands = (MazeGenBands *)data;
+    MazeGrid grid = bands->grid;
+    int width = grid.width;
+
+    int startRow = band*MAZE_GEN_BAND_ROWS;
+    int endRow = startRow + MAZE_GEN_BAND_ROWS;
+    if (endRow > grid.height) endRow = grid.height;
+
+    unsigned char *bandStart = grid.cells + (size_t)startRow*width;
+    unsigned char *bandEnd = grid.cells + (size_t)endRow*width;
+
+    MazeRandom rng = InitMazeRandom(bands->seed, (unsigned long long)band);
+
+    // STEP 1: Draw grid border, for band rows
+    for (int y = startRow; y < endRow; y++)
+    {
+        if ((y == 0) || (y == (grid.height - 1))) memset(grid.cells + (size_t)y*width, MAZE_CELL_WALL, width);
+        else
+        {
+            grid.cells[(size_t)y*width] = MAZE_CELL_WALL;
+            grid.cells[(size_t)y*width + width - 1] = MAZE_CELL_WALL;
+        }
+    }
+
+    // STEP 2: Set some random points in band rows, at specific row-column distances
+    int *mazePoints = bands->points + GetBandPointsOffset(bands, band);
+    int mazePointCounter = 0;
+
+    int firstPointRow = ((startRow + bands->spacingRows - 1)/bands->spacingRows)*bands->spacingRows;
+    if (firstPointRow == 0) firstPointRow = bands->spacingRows;
+
+    for (int y = firstPointRow; (y < endRow) && (y < (grid.height - 1)); y += bands->spacingRows)
+    {
+        for (int x = bands->spacingCols; x < (width - 1); x += bands->spacingCols)
+        {
+            if (GetMazeRandomValue(&rng, 0, 100) <= bands->pointThreshold)
+            {
+                mazePoints[mazePointCounter] = y*width + x;
+                mazePointCounter++;
+            }
+        }
+    }
+
+    for (int i = 0; i < mazePointCounter; i++) grid.cells[mazePoints[i]] = MAZE_CELL_WALL;
+
+    // STEP 3: Draw lines from every point (shuffled) in a random direction, clipped to band rows
+    int directions[4] = { 1, -1, width, -width };
+
+    for (int i = mazePointCounter - 1; i > 0; i--)
+    {
+        int j = GetMazeRandomValue(&rng, 0, i);
+        int temp = mazePoints[i];
+        mazePoints[i] = mazePoints[j];
+        mazePoints[j] = temp;
+    }
+
+    // NOTE: Continuations reuse band points slots, one line per point at most
+    int *continuations = bands->continuations + 2*GetBandPointsOffset(bands, band);
+    int continuationCounter = 0;
+
+    for (int i = 0; i < mazePointCounter; i++)
+    {
+        int currentDir = directions[GetMazeRandomValue(&rng, 0, 3)];
+        unsigned char *nextCell = grid.cells + mazePoints[i] + currentDir;
+
+        while ((nextCell >= bandStart) && (nextCell < bandEnd) && (*nextCell == MAZE_CELL_FLOOR))
+        {
+            *nextCell = MAZE_CELL_WALL;
+            nextCell += currentDir;
+        }
+
+        // Line reached band edge, it will be continued once all bands are done
+        if ((nextCell < bandStart) || (nextCell >= bandEnd))
+        {
+            continuations[2*continuationCounter] = (int)(nextCell - grid.cells);
+            continuations[2*continuationCounter + 1] = currentDir;
+            continuationCounter++;
+        }
+    }
+
+    bands->continuationCounts[band] = continuationCounter;
+}
+
+// Generate perfect maze with recursive backtracker (depth-first search, random neighbor order)
+// NOTE: No stack required, every visited room cell stores the direction back to the room it was
+// reached from (cell bits 4-6), cleared when backtracking, so working memory is constant
+static void GenMazeBacktracker(MazeGrid grid, unsigned int seed)
+{
+    int width = grid.width;
+    int roomCols = (width - 1)/2;
+    int roomRows = (grid.height - 1)/2;
+
+    memset(grid.cells, MAZE_CELL_WALL, (size_t)width*grid.height);
+
+    if ((roomCols <= 0) || (roomRows <= 0)) return;
+
+    MazeRandom rng = InitMazeRandom(seed, MAZE_GEN_STREAM + MAZE_GEN_BACKTRACKER);
+    int steps[4] = { 1, -1, width, -width };    // Room to wall cell index offsets, room to room is twice
+
+    // Start from a random room, unvisited rooms are walls
+    int x = 2*GetMazeRandomValue(&rng, 0, roomCols - 1) + 1;
+    int y = 2*GetMazeRandomValue(&rng, 0, roomRows - 1) + 1;
+    unsigned char *room = grid.cells + (size_t)y*width + x;
+
+    *room = MAZE_CELL_FLOOR;
+
+    while (true)
+    {
+        // Unvisited neighbor rooms, inside rooms area
+        int options[4] = { 0 };
+        int optionCount = 0;
+
+        if ((x < (2*roomCols - 1)) && (room[2*steps[0]] == MAZE_CELL_WALL)) options[optionCount++] = 0;
+        if ((x > 1) && (room[2*steps[1]] == MAZE_CELL_WALL)) options[optionCount++] = 1;
+        if ((y < (2*roomRows - 1)) && (room[2*steps[2]] == MAZE_CELL_WALL)) options[optionCount++] = 2;
+        if ((y > 1) && (room[2*steps[3]] == MAZE_CELL_WALL)) options[optionCount++] = 3;
+
+        if (optionCount > 0)
+        {
+            int direction = options[GetMazeRandomValue(&rng, 0, optionCount - 1)];
+
+            room[steps[direction]] = MAZE_CELL_FLOOR;
+            room += 2*steps[direction];
+            x += 2*roomStepsX[direction];
+            y += 2*roomStepsY[direction];
+            *room = (unsigned char)(MAZE_CELL_FLOOR | (((direction ^ 1) + 1) << 4));
+        }
+        else
+        {
+            // Backtrack, start room has no direction back
+            int back = (*room >> 4) - 1;
+
+            *room = MAZE_CELL_FLOOR;
+
+            if (back < 0) break;
+
+            room += 2*steps[back];
+            x += 2*roomStepsX[back];
+            y += 2*roomStepsY[back];
+        }
+    }
+
+    ExtendMazeRooms(grid);
+}
+
+// Generate perfect maze with Wilson's algorithm (loop-erased random walks, uniform spanning tree)
+// NOTE: Every walked room cell stores its last exit direction (cell bits 4-6), so loops are erased
+// just by overwriting it, the walk is then retraced from its start; working memory is constant
+static void GenMazeWilson(MazeGrid grid, unsigned int seed)
+{
+    int width = grid.width;
+    int roomCols = (width - 1)/2;
+    int roomRows = (grid.height - 1)/2;
+
+    memset(grid.cells, MAZE_CELL_WALL, (size_t)width*grid.height);
+
+    if ((roomCols <= 0) || (roomRows <= 0)) return;
+
+    MazeRandom rng = InitMazeRandom(seed, MAZE_GEN_STREAM + MAZE_GEN_WILSON);
+    int steps[4] = { 1, -1, width, -width };    // Room to wall cell index offsets, room to room is twice
+
+    // Maze starts from a random room, rooms in maze are floor (walked rooms keep wall kind)
+    grid.cells[(size_t)(2*GetMazeRandomValue(&rng, 0, roomRows - 1) + 1)*width + 2*GetMazeRandomValue(&rng, 0, roomCols - 1) + 1] = MAZE_CELL_FLOOR;
+
+    // Walk from every room not in maze yet, in rows order, until maze is reached
+    for (int startY = 1; startY < 2*roomRows; startY += 2)
+    {
+        for (int startX = 1; startX < 2*roomCols; startX += 2)
+        {
+            unsigned char *start = grid.cells + (size_t)startY*width + startX;
+
+            if ((*start & 0x03) == MAZE_CELL_FLOOR) continue;
+
+            unsigned char *room = start;
+            int x = startX;
+            int y = startY;
+
+            while ((*room & 0x03) != MAZE_CELL_FLOOR)
+            {
+                int direction = 0;
+
+                // Directions out of rooms area are picked again, so all neighbor rooms are equally likely
+                do direction = GetMazeRandomValue(&rng, 0, 3);
+                while (((direction == 0) && (x >= (2*roomCols - 1))) || ((direction == 1) && (x <= 1)) ||
+                       ((direction == 2) && (y >= (2*roomRows - 1))) || ((direction == 3) && (y <= 1)));
+
+                *room = (unsigned char)(MAZE_CELL_WALL | ((direction + 1) << 4));
+                room += 2*steps[direction];
+                x += 2*roomStepsX[direction];
+                y += 2*roomStepsY[direction];
+            }
+
+            // Retrace walk with last exit directions, adding loop-erased path to maze
+            for (room = start; (*room & 0x03) != MAZE_CELL_FLOOR; )
+            {
+                int direction = (*room >> 4) - 1;
+
+                *room = MAZE_CELL_FLOOR;
+                room[steps[direction]] = MAZE_CELL_FLOOR;
+                room += 2*steps[direction];
+            }
+        }
+    }
+
+    ExtendMazeRooms(grid);
+}
+
+// Copy last rooms column and row to spare column and row of even sized grids,
+// so all inner cells (and cell (width - 2, height - 2)) belong to maze
+static void ExtendMazeRooms(MazeGrid grid)
+{
+    int width = grid.width;
+    int height = grid.height;
+
+    if (((width%2) == 0) && (width >= 4))
+    {
+        for (int y = 1; y < (height - 1); y++) grid.cells[(size_t)y*width + width - 2] = grid.cells[(size_t)y*width + width - 3];
+    }
+
+    if (((height%2) == 0) && (height >= 4)) memcpy(grid.cells + (size_t)(height - 2)*width, grid.cells + (size_t)(height - 3)*width, width);
+}
+
+// Copy streamed row into grid (row callback)
+static void CopyMazeGridRow(const unsigned char *cells, int width, int y, void *userData)
+{
+    MazeGrid *grid = (MazeGrid *)userData;
+
+    memcpy(grid->cells + (size_t)y*grid->width, cells, width);
+}
@@ -0,0 +1,140 @@
+/*******************************************************************************************
+*
+*   maze_grid - Compact maze cells grid, used as the maze model
+*
+*   Every maze cell is stored as one byte (MazeCell), row-major, so cell queries are
+*   a direct array access, no pixel format decoding required; Image/Texture data is
+*   only derived from the grid for display
+*
+*   Maze generation algorithms (MazeGenAlgorithm) all write into grid cells buffer:
+*     - MAZE_GEN_GRID: Random points at rows-columns spacing, lines drawn from every point
+*     - MAZE_GEN_BACKTRACKER: Recursive backtracker (depth-first), long winding corridors
+*     - MAZE_GEN_WILSON: Wilson's loop-erased random walks, uniform spanning tree
+*     - MAZE_GEN_ELLER: Eller's row by row sets, can be streamed using O(width) memory
+*
+*   Backtracker, Wilson's and Eller's generate perfect mazes (one path between any two
+*   walkable cells): rooms at odd coordinates, walls between them removed when connected
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#ifndef MAZE_GRID_H
+#define MAZE_GRID_H
+
+#include "raylib.h"
+#include "maze_arena.h"     // Required for: MazeArena, AllocMazeArena()
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Declare new data type: Point
+typedef struct Point {
+    int x;
+    int y;
+} Point;
+
+// Maze cell kinds
+// NOTE: Values fit in 2 bits, used as index for display colors and atlas tiles
+typedef enum MazeCell {
+    MAZE_CELL_FLOOR = 0,        // Walkable cell
+    MAZE_CELL_WALL,             // Wall cell, blocks player movement
+    MAZE_CELL_ITEM,             // Item to be picked up
+    MAZE_CELL_EXIT,             // Maze exit, level is finished when reached
+} MazeCell;
+
+#define MAZE_CELL_KINDS     4
+
+// Maze rows generated by every parallel generation job
+// NOTE: Bands layout only depends on maze height, never on threads count,
+// so output is the same for a given seed, whatever threads are used
+#define MAZE_GEN_BAND_ROWS  256
+
+// Maze generation algorithms
+typedef enum MazeGenAlgorithm {
+    MAZE_GEN_GRID = 0,          // Grid points and lines, parallel bands (GenMazeGridParallel())
+    MAZE_GEN_BACKTRACKER,       // Recursive backtracker, no working memory (path stored in cells)
+    MAZE_GEN_WILSON,            // Wilson's algorithm, no working memory (walks stored in cells)
+    MAZE_GEN_ELLER,             // Eller's algorithm, O(width) working memory
+} MazeGenAlgorithm;
+
+#define MAZE_GEN_ALGORITHMS 4
+
+// Maze generation config
+typedef struct MazeGenConfig {
+    MazeGenAlgorithm algorithm; // Generation algorithm
+    unsigned int seed;          // Random seed, same maze for same config and size
+    int spacingRows;            // Grid algorithm: points rows spacing
+    int spacingCols;            // Grid algorithm: points columns spacing
+    float pointChance;          // Grid algorithm: point chance (0.0..1.0)
+    int threadCount;            // Grid algorithm: generation threads, if <= 0, all hardware threads are used
+} MazeGenConfig;
+
+// Maze row callback, used by streamed generation, row cells are only valid during callback
+typedef void (*MazeRowCallback)(const unsigned char *cells, int width, int y, void *userData);
+
+// Seeded random numbers generator (SplitMix64), independent from raylib global generator
+typedef struct MazeRandom {
+    unsigned long long state;
+} MazeRandom;
+
+// Maze cells grid
+typedef struct MazeGrid {
+    int width;                  // Grid width in cells
+    int height;                 // Grid height in cells
+    unsigned char *cells;       // Grid cells (MazeCell), one byte per cell, row-major
+} MazeGrid;
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+MazeGrid LoadMazeGrid(int width, int height);                                           // Load maze grid, all cells set to floor
+void UnloadMazeGrid(MazeGrid grid);                                                     // Unload maze grid from memory (RAM)
+
+// Generate procedural maze grid, using grid-based algorithm
+MazeGrid GenMazeGrid(int width, int height, int spacingRows, int spacingCols, float pointChance);
+
+// Generate procedural maze grid, using grid-based algorithm, with all memory taken from arena
+MazeGrid GenMazeGridArena(MazeArena *arena, int width, int height, int spacingRows, int spacingCols, float pointChance);
+
+// Generate procedural maze grid in parallel bands, same result for a seed whatever threadCount is used
+// NOTE: If threadCount <= 0, all hardware threads are used
+MazeGrid GenMazeGridParallel(int width, int height, int spacingRows, int spacingCols, float pointChance, unsigned int seed, int threadCount);
+
+MazeGrid GenMazeGridEx(int width, int height, MazeGenConfig config);                   // Generate procedural maze grid, using config algorithm
+bool FillMazeGrid(MazeGrid grid, MazeGenConfig config);                                 // Fill grid cells with a generated maze, grid memory can be any (heap, arena, file)
+bool GenMazeGridRows(int width, int height, unsigned int seed, MazeRowCallback callback, void *userData);  // Generate maze with Eller's algorithm, streamed row by row
+const char *GetMazeGenAlgorithmName(MazeGenAlgorithm algorithm);                       // Get algorithm name (grid, backtracker, wilson, eller)
+
+MazeRandom InitMazeRandom(unsigned long long seed, unsigned long long stream);          // Init random generator for a seed and stream
+int GetMazeRandomValue(MazeRandom *rng, int min, int max);                              // Get random value between min and max (both included)
+
+Color GetMazeCellColor(MazeCell cell);                                                  // Get display color for a cell kind
+Image GenImageFromMazeGrid(MazeGrid grid);                                              // Generate image from maze grid (R8G8B8A8), for display
+
+// Get maze cell kind, cells out of grid are considered walls
+static inline MazeCell GetMazeCell(MazeGrid grid, int x, int y)
+{
+    // NOTE: Unsigned comparison checks both limits at once
+    return (((unsigned int)x < (unsigned int)grid.width) && ((unsigned int)y < (unsigned int)grid.height))?
+        (MazeCell)grid.cells[y*grid.width + x] : MAZE_CELL_WALL;
+}
+
+// Set maze cell kind, cells out of grid are ignored
+static inline void SetMazeCell(MazeGrid *grid, int x, int y, MazeCell cell)
+{
+    if (((unsigned int)x < (unsigned int)grid->width) && ((unsigned int)y < (unsigned int)grid->height))
+    {
+        grid->cells[y*grid->width + x] = (unsigned char)cell;
+    }
+}
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // MAZE_GRID_H
@@ -0,0 +1,167 @@
+/*******************************************************************************************
+*
+*   maze_items - Maze items store, hash map keyed by item cell
+*
+*   NOTE: Removed items leave no tombstones, following slots are shifted back
+*   (backward shift deletion), so lookups never degrade after many removals
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "maze_items.h"
+
+#include <stdlib.h>     // Required for: malloc(), free()
+
+#define MIN_ITEMS_CAPACITY      16
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Declaration
+//----------------------------------------------------------------------------------
+static unsigned int HashCell(Point cell);                           // Get hash for a cell
+static void ResizeMazeItems(MazeItems *items, int capacity);        // Reallocate slots, inserting again all items
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Load items store, with initial capacity
+// NOTE: Capacity is rounded up to a power of 2
+MazeItems LoadMazeItems(int capacity)
+{
+    MazeItems items = { 0 };
+
+    int slots = MIN_ITEMS_CAPACITY;
+    while (slots < capacity) slots *= 2;
+
+    ResizeMazeItems(&items, slots);
+
+    return items;
+}
+
+// Unload items store from memory (RAM)
+void UnloadMazeItems(MazeItems items)
+{
+    free(items.slots);
+}
+
+// Remove all items, keeping memory
+void ClearMazeItems(MazeItems *items)
+{
+    for (int i = 0; i < items->capacity; i++) items->slots[i].cell.x = MAZE_ITEM_EMPTY_SLOT;
+
+    items->count = 0;
+}
+
+// Add item at cell, returns false if cell already has an item
+bool AddMazeItem(MazeItems *items, Point cell, int value)
+{
+    // Keep load factor under 0.75, so probe sequences stay short
+    if ((items->count + 1)*4 > items->capacity*3) ResizeMazeItems(items, items->capacity*2);
+
+    unsigned int mask = (unsigned int)items->capacity - 1;
+
+    for (unsigned int i = HashCell(cell) & mask; ; i = (i + 1) & mask)
+    {
+        MazeItem *slot = &items->slots[i];
+
+        if (slot->cell.x == MAZE_ITEM_EMPTY_SLOT)
+        {
+            *slot = (MazeItem){ cell, value };
+            items->count++;
+            return true;
+        }
+        else if ((slot->cell.x == cell.x) && (slot->cell.y == cell.y)) return false;
+    }
+}
+
+// Remove item at cell, returns false if no item found
+bool RemoveMazeItem(MazeItems *items, Point cell, MazeItem *removed)
+{
+    if (items->capacity == 0) return false;
+
+    unsigned int mask = (unsigned int)items->capacity - 1;
+    unsigned int i = HashCell(cell) & mask;
+
+    // Find item slot
+    while (true)
+    {
+        MazeItem *slot = &items->slots[i];
+
+        if (slot->cell.x == MAZE_ITEM_EMPTY_SLOT) return false;
+        if ((slot->cell.x == cell.x) && (slot->cell.y == cell.y)) break;
+
+        i = (i + 1) & mask;
+    }
+
+    if (removed != NULL) *removed = items->slots[i];
+
+    // Shift back following items of the probe sequence, filling the hole,
+    // an item can only move back if its home slot is not between hole and its current slot
+    unsigned int hole = i;
+
+    for (unsigned int j = (i + 1) & mask; items->slots[j].cell.x != MAZE_ITEM_EMPTY_SLOT; j = (j + 1) & mask)
+    {
+        unsigned int home = HashCell(items->slots[j].cell) & mask;
+
+        if (((j - home) & mask) >= ((j - hole) & mask))
+        {
+            items->slots[hole] = items->slots[j];
+            hole = j;
+        }
+    }
+
+    items->slots[hole].cell.x = MAZE_ITEM_EMPTY_SLOT;
+    items->count--;
+
+    return true;
+}
+
+// Get item at cell, NULL if no item found
+const MazeItem *GetMazeItem(MazeItems items, Point cell)
+{
+    if (items.capacity == 0) return NULL;
+
+    unsigned int mask = (unsigned int)items.capacity - 1;
+
+    for (unsigned int i = HashCell(cell) & mask; ; i = (i + 1) & mask)
+    {
+        const MazeItem *slot = &items.slots[i];
+
+        if (slot->cell.x == MAZE_ITEM_EMPTY_SLOT) return NULL;
+        if ((slot->cell.x == cell.x) && (slot->cell.y == cell.y)) return slot;
+    }
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+// Get hash for a cell, mixing both coordinates (64bit finalizer)
+static unsigned int HashCell(Point cell)
+{
+    unsigned long long key = ((unsigned long long)(unsigned int)cell.y << 32) | (unsigned int)cell.x;
+
+    key ^= key >> 33;
+    key *= 0xff51afd7ed558ccdULL;
+    key ^= key >> 33;
+
+    return (unsigned int)key;
+}
+
+// Reallocate slots, inserting again all items
+static void ResizeMazeItems(MazeItems *items, int capacity)
+{
+    MazeItem *oldSlots = items->slots;
+    int oldCapacity = items->capacity;
+
+    items->slots = (MazeItem *)malloc(capacity*sizeof(MazeItem));
+    items->capacity = capacity;
+
+    ClearMazeItems(items);
+
+    for (int i = 0; i < oldCapacity; i++)
+    {
+        if (oldSlots[i].cell.x != MAZE_ITEM_EMPTY_SLOT) AddMazeItem(items, oldSlots[i].cell, oldSlots[i].value);
+    }
+
+    free(oldSlots);
+}
@@ -0,0 +1,58 @@
+/*******************************************************************************************
+*
+*   maze_items - Maze items store, hash map keyed by item cell
+*
+*   Open addressing (linear probing) hash map, growing as required, so any number
+*   of items can be stored with O(1) insert, remove and lookup by cell
+*
+*   NOTE: Cells with x = MAZE_ITEM_EMPTY_SLOT are reserved to mark empty slots
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#ifndef MAZE_ITEMS_H
+#define MAZE_ITEMS_H
+
+#include "maze_grid.h"      // Required for: Point
+
+#include <limits.h>         // Required for: INT_MIN
+
+#define MAZE_ITEM_EMPTY_SLOT    INT_MIN     // Cell x value marking an empty slot
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Maze item
+typedef struct MazeItem {
+    Point cell;             // Item cell
+    int value;              // Item value (score on pickup)
+} MazeItem;
+
+// Maze items store
+typedef struct MazeItems {
+    int count;              // Items stored
+    int capacity;           // Slots allocated, always power of 2
+    MazeItem *slots;        // Items slots, open addressing (empty slots cell.x = MAZE_ITEM_EMPTY_SLOT)
+} MazeItems;
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+MazeItems LoadMazeItems(int capacity);                                  // Load items store, with initial capacity
+void UnloadMazeItems(MazeItems items);                                  // Unload items store from memory (RAM)
+void ClearMazeItems(MazeItems *items);                                  // Remove all items, keeping memory
+
+bool AddMazeItem(MazeItems *items, Point cell, int value);              // Add item at cell, returns false if cell already has an item
+bool RemoveMazeItem(MazeItems *items, Point cell, MazeItem *removed);   // Remove item at cell, returns false if no item found
+const MazeItem *GetMazeItem(MazeItems items, Point cell);               // Get item at cell, NULL if no item found
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // MAZE_ITEMS_H
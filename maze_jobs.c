@@ -0,0 +1,225 @@
+/*******************************************************************************************
+*
+*   maze_jobs - Minimal parallel-for over a pool of worker threads
+*
+*   NOTE: Uses pthreads (available in MinGW/w64devkit through winpthreads),
+*   define MAZE_NO_THREADS to run all jobs in the calling thread
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "maze_jobs.h"
+
+#include <stdbool.h>            // Required for: bool
+
+#if !defined(MAZE_NO_THREADS)
+    #include <pthread.h>        // Required for: pthread_create(), pthread_join(), pthread_cond_wait()...
+    #include <stdatomic.h>      // Required for: atomic_int, atomic_fetch_add()
+    #include <stdint.h>         // Required for: intptr_t
+    #if !defined(_WIN32)
+        #include <unistd.h>     // Required for: sysconf()
+    #endif
+#endif
+
+#define MAX_JOB_THREADS     64
+
+#if !defined(MAZE_NO_THREADS)
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Jobs shared by all workers of a RunMazeJobs() call
+typedef struct MazeJobQueue {
+    MazeJobFunc func;
+    void *data;
+    int jobCount;
+    atomic_int nextJob;         // Next job index to be picked by a worker
+} MazeJobQueue;
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+// NOTE: Pool state is guarded by jobsMutex, queue jobs are only picked through nextJob
+static pthread_mutex_t jobsMutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t jobsQueued = PTHREAD_COND_INITIALIZER;       // Signaled when jobs are queued or on closing
+static pthread_cond_t jobsDone = PTHREAD_COND_INITIALIZER;         // Signaled when last active worker is done
+static pthread_t jobsWorkers[MAX_JOB_THREADS - 1] = { 0 };
+static int jobsWorkerCount = 0;
+static bool jobsInitialized = false;
+static bool jobsClosing = false;
+static bool jobsBusy = false;               // Jobs being run by pool, nested or concurrent calls run in calling thread
+static MazeJobQueue jobsQueue = { 0 };
+static unsigned int jobsGeneration = 0;     // Queued RunMazeJobs() calls, workers wait for a new one
+static int jobsActiveWorkers = 0;           // Workers taking part in current call (first ones)
+static int jobsPendingWorkers = 0;          // Active workers still picking jobs
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Declaration
+//----------------------------------------------------------------------------------
+static void PickMazeJobs(MazeJobQueue *queue);  // Pick and run jobs until queue is empty
+static void *MazeJobsWorker(void *arg);         // Worker thread, waits for queued jobs until closing
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Init jobs pool, launching workers (calling thread is also a worker, so threadCount - 1 are launched)
+// NOTE: If threadCount <= 0, all hardware threads are used
+void InitMazeJobs(int threadCount)
+{
+#if !defined(MAZE_NO_THREADS)
+    if (jobsInitialized) return;
+
+    if (threadCount <= 0) threadCount = GetMazeJobsThreadCount();
+    if (threadCount > MAX_JOB_THREADS) threadCount = MAX_JOB_THREADS;
+
+    // NOTE: No workers running, generation can be reset, workers start waiting for generation 1
+    jobsClosing = false;
+    jobsGeneration = 0;
+    jobsWorkerCount = 0;
+
+    for (int i = 0; i < (threadCount - 1); i++)
+    {
+        if (pthread_create(&jobsWorkers[jobsWorkerCount], NULL, MazeJobsWorker, (void *)(intptr_t)jobsWorkerCount) == 0) jobsWorkerCount++;
+    }
+
+    jobsInitialized = true;
+#else
+    (void)threadCount;
+#endif
+}
+
+// Close jobs pool, stopping workers
+// NOTE: Must not be called while jobs are running
+void CloseMazeJobs(void)
+{
+#if !defined(MAZE_NO_THREADS)
+    if (!jobsInitialized) return;
+
+    pthread_mutex_lock(&jobsMutex);
+    jobsClosing = true;
+    pthread_cond_broadcast(&jobsQueued);
+    pthread_mutex_unlock(&jobsMutex);
+
+    for (int i = 0; i < jobsWorkerCount; i++) pthread_join(jobsWorkers[i], NULL);
+
+    jobsWorkerCount = 0;
+    jobsInitialized = false;
+#endif
+}
+
+// Get number of hardware threads available
+int GetMazeJobsThreadCount(void)
+{
+#if defined(MAZE_NO_THREADS)
+    return 1;
+#else
+  #if defined(_WIN32)
+    int count = pthread_num_processors_np();
+  #else
+    int count = (int)sysconf(_SC_NPROCESSORS_ONLN);
+  #endif
+    return (count < 1)? 1 : ((count > MAX_JOB_THREADS)? MAX_JOB_THREADS : count);
+#endif
+}
+
+// Run jobs in parallel, returns once all jobs are done
+// NOTE: If threadCount <= 0, all pool workers are used, calling thread also works as a worker;
+// pool is initialized with all hardware threads on first call if InitMazeJobs() was not called
+void RunMazeJobs(MazeJobFunc func, void *data, int jobCount, int threadCount)
+{
+    if (jobCount <= 0) return;
+
+    if (threadCount <= 0) threadCount = GetMazeJobsThreadCount();
+    if (threadCount > jobCount) threadCount = jobCount;
+    if (threadCount > MAX_JOB_THREADS) threadCount = MAX_JOB_THREADS;
+
+#if !defined(MAZE_NO_THREADS)
+    if (threadCount > 1)
+    {
+        if (!jobsInitialized) InitMazeJobs(0);
+
+        pthread_mutex_lock(&jobsMutex);
+
+        if (!jobsBusy && (jobsWorkerCount > 0))
+        {
+            jobsBusy = true;
+            jobsQueue.func = func;
+            jobsQueue.data = data;
+            jobsQueue.jobCount = jobCount;
+            atomic_store(&jobsQueue.nextJob, 0);
+
+            jobsActiveWorkers = ((threadCount - 1) < jobsWorkerCount)? (threadCount - 1) : jobsWorkerCount;
+            jobsPendingWorkers = jobsActiveWorkers;
+            jobsGeneration++;
+
+            pthread_cond_broadcast(&jobsQueued);
+            pthread_mutex_unlock(&jobsMutex);
+
+            PickMazeJobs(&jobsQueue);
+
+            pthread_mutex_lock(&jobsMutex);
+            while (jobsPendingWorkers > 0) pthread_cond_wait(&jobsDone, &jobsMutex);
+            jobsBusy = false;
+            pthread_mutex_unlock(&jobsMutex);
+
+            return;
+        }
+
+        pthread_mutex_unlock(&jobsMutex);
+    }
+#endif
+
+    for (int i = 0; i < jobCount; i++) func(data, i);
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+#if !defined(MAZE_NO_THREADS)
+// Pick and run jobs until queue is empty
+static void PickMazeJobs(MazeJobQueue *queue)
+{
+    for (int index = atomic_fetch_add(&queue->nextJob, 1); index < queue->jobCount; index = atomic_fetch_add(&queue->nextJob, 1))
+    {
+        queue->func(queue->data, index);
+    }
+}
+
+// Worker thread, waits for queued jobs until closing
+// NOTE: Workers not active for a call only catch up with its generation, so they never
+// pick jobs of a call they do not take part in, active workers can not miss their call
+// (RunMazeJobs() waits for them before queuing next one)
+static void *MazeJobsWorker(void *arg)
+{
+    int workerIndex = (int)(intptr_t)arg;
+    unsigned int generation = 0;
+
+    pthread_mutex_lock(&jobsMutex);
+
+    while (!jobsClosing)
+    {
+        if (generation == jobsGeneration)
+        {
+            pthread_cond_wait(&jobsQueued, &jobsMutex);
+            continue;
+        }
+
+        generation = jobsGeneration;
+
+        if (workerIndex < jobsActiveWorkers)
+        {
+            pthread_mutex_unlock(&jobsMutex);
+            PickMazeJobs(&jobsQueue);
+            pthread_mutex_lock(&jobsMutex);
+
+            jobsPendingWorkers--;
+            if (jobsPendingWorkers == 0) pthread_cond_signal(&jobsDone);
+        }
+    }
+
+    pthread_mutex_unlock(&jobsMutex);
+
+    return NULL;
+}
+#endif
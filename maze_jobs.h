@@ -0,0 +1,34 @@
+/*******************************************************************************************
+*
+*   maze_jobs - Minimal parallel-for over a pool of worker threads
+*
+*   Workers are launched once (InitMazeJobs()) and wait for jobs between calls, so running
+*   jobs only wakes them up, no threads are created per call (safe to use every frame)
+*
+*   Jobs are identified by index and picked dynamically by workers, so the work done
+*   for every index must not depend on which thread runs it (required for determinism)
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#ifndef MAZE_JOBS_H
+#define MAZE_JOBS_H
+
+// Job callback, called once for every job index in [0..jobCount - 1]
+typedef void (*MazeJobFunc)(void *data, int index);
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+void InitMazeJobs(int threadCount);                                                     // Init jobs pool, launching workers (threadCount <= 0: all hardware threads)
+void CloseMazeJobs(void);                                                               // Close jobs pool, stopping workers
+int GetMazeJobsThreadCount(void);                                                       // Get number of hardware threads available
+void RunMazeJobs(MazeJobFunc func, void *data, int jobCount, int threadCount);           // Run jobs in parallel, returns once all jobs are done
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // MAZE_JOBS_H
@@ -0,0 +1,347 @@
+/*******************************************************************************************
+*
+*   maze_path - Maze distance fields for reachability and shortest path queries
+*
+*   Incremental updates:
+*     - Cell becomes walkable: its distance is taken from its neighbors and
+*       decreased distances are propagated with a BFS from that cell
+*     - Cell becomes wall: all cells depending on it (distance growing by one, from it)
+*       are invalidated and recomputed from the still valid cells around them,
+*       processed in increasing distance order, so only the affected region is visited
+*     - Several cells changed (editor strokes, shapes): all of them are processed at once,
+*       invalidating cells depending on any new wall and recomputing them in one pass
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "maze_path.h"
+
+#include <stdlib.h>     // Required for: malloc(), free(), qsort()
+#include <string.h>     // Required for: memset()
+
+#define DISTANCE_INVALIDATED    0x80000000u     // Distance flag for cells being invalidated (previous distance kept in low bits)
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Cell to be recomputed after a wall was added, with its best distance from valid neighbors
+typedef struct DistanceSeed {
+    int index;
+    unsigned int distance;
+} DistanceSeed;
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Declaration
+//----------------------------------------------------------------------------------
+static int GetCellNeighbors(int width, int height, int index, int *neighbors);                  // Get in-grid neighbors of a cell, returns count
+static void PropagateDistances(MazeDistanceField *field, MazeGrid grid, int queueStart, int queueEnd);  // BFS relaxation of queued cells
+static unsigned int GetNeighborsDistance(MazeDistanceField *field, int index);                    // Get best distance from cell neighbors (lowest neighbor distance + 1)
+static int CompareDistanceSeeds(const void *a, const void *b);
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Load distance field, computing distances to source
+MazeDistanceField LoadMazeDistanceField(MazeGrid grid, Point source)
+{
+    MazeDistanceField field = { 0 };
+    size_t cellCount = (size_t)grid.width*grid.height;
+
+    if (cellCount == 0) return field;
+
+    field.width = grid.width;
+    field.height = grid.height;
+    field.source = source;
+    field.distances = (unsigned int *)malloc(cellCount*sizeof(unsigned int));
+    field.queue = (int *)malloc(cellCount*sizeof(int));
+
+    ResetMazeDistanceField(&field, grid);
+
+    return field;
+}
+
+// Load distance field, computing distances to source, with all memory taken from arena
+// NOTE: Field data stays in arena (freed on arena reset), UnloadMazeDistanceField() must not be called
+MazeDistanceField LoadMazeDistanceFieldArena(MazeArena *arena, MazeGrid grid, Point source)
+{
+    MazeDistanceField field = { 0 };
+    size_t cellCount = (size_t)grid.width*grid.height;
+
+    if (cellCount == 0) return field;
+
+    field.distances = (unsigned int *)AllocMazeArena(arena, cellCount*sizeof(unsigned int));
+    field.queue = (int *)AllocMazeArena(arena, cellCount*sizeof(int));
+
+    if ((field.distances == NULL) || (field.queue == NULL)) return (MazeDistanceField){ 0 };
+
+    field.width = grid.width;
+    field.height = grid.height;
+    field.source = source;
+
+    ResetMazeDistanceField(&field, grid);
+
+    return field;
+}
+
+// Unload distance field from memory (RAM)
+void UnloadMazeDistanceField(MazeDistanceField field)
+{
+    free(field.distances);
+    free(field.queue);
+}
+
+// Reset distance field, computing again all distances to source (no reallocation)
+// NOTE: Cheaper than many incremental updates when lots of cells changed at once
+void ResetMazeDistanceField(MazeDistanceField *field, MazeGrid grid)
+{
+    if ((field->distances == NULL) || (field->width != grid.width) || (field->height != grid.height)) return;
+
+    memset(field->distances, 0xff, (size_t)field->width*field->height*sizeof(unsigned int));     // All cells MAZE_DISTANCE_UNREACHABLE
+
+    if (GetMazeCell(grid, field->source.x, field->source.y) != MAZE_CELL_WALL)
+    {
+        int sourceIndex = field->source.y*grid.width + field->source.x;
+
+        field->distances[sourceIndex] = 0;
+        field->queue[0] = sourceIndex;
+
+        PropagateDistances(field, grid, 0, 1);
+    }
+}
+
+// Update distances after a cell changed in grid (incremental)
+// NOTE: Must be called after the grid is modified, with the only cell changed since last
+// update; if several cells changed, use UpdateMazeDistanceFieldCells() with all of them
+void UpdateMazeDistanceField(MazeDistanceField *field, MazeGrid grid, Point cell)
+{
+    UpdateMazeDistanceFieldCells(field, grid, &cell, 1);
+}
+
+// Update distances after several cells changed in grid (incremental, all cells at once)
+// NOTE: Cells depending on any closed cell are invalidated together and recomputed in a single
+// pass with opened cells, so every affected cell is visited once, whatever the cells changed
+void UpdateMazeDistanceFieldCells(MazeDistanceField *field, MazeGrid grid, const Point *cells, int count)
+{
+    if ((field->distances == NULL) || (field->width != grid.width) || (field->height != grid.height) || (count <= 0)) return;
+
+    int width = field->width;
+    int height = field->height;
+    unsigned int *distances = field->distances;
+    int *queue = field->queue;
+    int queueEnd = 0;
+    int neighbors[4] = { 0 };
+
+    // Closed cells (walls still with a distance) are invalidated, marked keeping their distance
+    for (int c = 0; c < count; c++)
+    {
+        if (((unsigned int)cells[c].x >= (unsigned int)width) || ((unsigned int)cells[c].y >= (unsigned int)height)) continue;
+
+        int index = cells[c].y*width + cells[c].x;
+
+        if ((grid.cells[index] == MAZE_CELL_WALL) && (distances[index] < DISTANCE_INVALIDATED))
+        {
+            distances[index] |= DISTANCE_INVALIDATED;
+            queue[queueEnd++] = index;
+        }
+    }
+
+    // Invalidate all cells that could depend on closed cells: neighbors one step further
+    // than an invalidated cell, marked ones are never matched again
+    for (int q = 0; q < queueEnd; q++)
+    {
+        unsigned int dependent = (distances[queue[q]] & ~DISTANCE_INVALIDATED) + 1;
+        int neighborCount = GetCellNeighbors(width, height, queue[q], neighbors);
+
+        for (int i = 0; i < neighborCount; i++)
+        {
+            if (distances[neighbors[i]] == dependent)
+            {
+                distances[neighbors[i]] |= DISTANCE_INVALIDATED;
+                queue[queueEnd++] = neighbors[i];
+            }
+        }
+    }
+
+    for (int q = 0; q < queueEnd; q++) distances[queue[q]] = MAZE_DISTANCE_UNREACHABLE;
+
+    // Get invalidated cells and opened cells (walkable, no distance) next to valid cells, with their best distance
+    DistanceSeed *seeds = (DistanceSeed *)malloc((queueEnd + count)*sizeof(DistanceSeed));
+    int seedCount = 0;
+
+    for (int q = 0; q < queueEnd; q++)
+    {
+        if (grid.cells[queue[q]] == MAZE_CELL_WALL) continue;
+
+        unsigned int best = GetNeighborsDistance(field, queue[q]);
+
+        if (best != MAZE_DISTANCE_UNREACHABLE) seeds[seedCount++] = (DistanceSeed){ queue[q], best };
+    }
+
+    for (int c = 0; c < count; c++)
+    {
+        if (((unsigned int)cells[c].x >= (unsigned int)width) || ((unsigned int)cells[c].y >= (unsigned int)height)) continue;
+
+        int index = cells[c].y*width + cells[c].x;
+
+        if ((grid.cells[index] == MAZE_CELL_WALL) || (distances[index] != MAZE_DISTANCE_UNREACHABLE)) continue;
+
+        unsigned int best = ((cells[c].x == field->source.x) && (cells[c].y == field->source.y))? 0 : GetNeighborsDistance(field, index);
+
+        if (best != MAZE_DISTANCE_UNREACHABLE) seeds[seedCount++] = (DistanceSeed){ index, best };
+    }
+
+    qsort(seeds, seedCount, sizeof(DistanceSeed), CompareDistanceSeeds);
+
+    // Recompute distances merging seeds and BFS queue, always taking the lowest distance,
+    // so every cell is finalized the first time it's set (decreased distances of valid cells included)
+    int queueStart = 0;
+    int seedIndex = 0;
+    queueEnd = 0;
+
+    while ((seedIndex < seedCount) || (queueStart < queueEnd))
+    {
+        int current = 0;
+
+        if ((seedIndex < seedCount) && ((queueStart == queueEnd) || (seeds[seedIndex].distance <= distances[queue[queueStart]])))
+        {
+            DistanceSeed seed = seeds[seedIndex++];
+
+            if (seed.distance >= distances[seed.index]) continue;   // Already reached from a closer cell
+
+            distances[seed.index] = seed.distance;
+            current = seed.index;
+        }
+        else current = queue[queueStart++];
+
+        int neighborCount = GetCellNeighbors(width, height, current, neighbors);
+
+        for (int i = 0; i < neighborCount; i++)
+        {
+            int next = neighbors[i];
+
+            if ((grid.cells[next] != MAZE_CELL_WALL) && (distances[next] > (distances[current] + 1)))
+            {
+                distances[next] = distances[current] + 1;
+                queue[queueEnd++] = next;
+            }
+        }
+    }
+
+    free(seeds);
+}
+
+// Set field source cell, distances computed again only if source changed (no reallocation)
+// NOTE: Moving the source changes the distance of every reachable cell, a full BFS is
+// cheaper than any incremental update in that case, so moving targets (i.e. player)
+// only recompute the field when they enter a new cell, not on every position change
+void SetMazeDistanceFieldSource(MazeDistanceField *field, MazeGrid grid, Point source)
+{
+    if ((source.x == field->source.x) && (source.y == field->source.y)) return;
+
+    field->source = source;
+
+    ResetMazeDistanceField(field, grid);
+}
+
+// Get shortest path cells from a cell to source, returns path length
+// NOTE: Path includes from and source cells, following decreasing distances
+int GetMazePath(MazeDistanceField field, Point from, Point *path, int maxLength)
+{
+    unsigned int distance = GetMazeDistance(field, from.x, from.y);
+
+    if ((distance == MAZE_DISTANCE_UNREACHABLE) || (maxLength <= 0)) return 0;
+
+    int index = from.y*field.width + from.x;
+    int length = 0;
+    int neighbors[4] = { 0 };
+
+    path[length++] = from;
+
+    while ((distance > 0) && (length < maxLength))
+    {
+        int count = GetCellNeighbors(field.width, field.height, index, neighbors);
+
+        for (int i = 0; i < count; i++)
+        {
+            if (field.distances[neighbors[i]] == (distance - 1))
+            {
+                index = neighbors[i];
+                break;
+            }
+        }
+
+        distance--;
+        path[length++] = (Point){ index%field.width, index/field.width };
+    }
+
+    return length;
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+// Get in-grid neighbors of a cell (4-connected), returns count
+static int GetCellNeighbors(int width, int height, int index, int *neighbors)
+{
+    int x = index%width;
+    int y = index/width;
+    int count = 0;
+
+    if (x > 0) neighbors[count++] = index - 1;
+    if (x < (width - 1)) neighbors[count++] = index + 1;
+    if (y > 0) neighbors[count++] = index - width;
+    if (y < (height - 1)) neighbors[count++] = index + width;
+
+    return count;
+}
+
+// BFS relaxation of queued cells, queue grows while distances are decreased
+static void PropagateDistances(MazeDistanceField *field, MazeGrid grid, int queueStart, int queueEnd)
+{
+    int *queue = field->queue;
+    unsigned int *distances = field->distances;
+    int neighbors[4] = { 0 };
+
+    while (queueStart < queueEnd)
+    {
+        int current = queue[queueStart++];
+        unsigned int nextDistance = distances[current] + 1;
+        int count = GetCellNeighbors(field->width, field->height, current, neighbors);
+
+        for (int i = 0; i < count; i++)
+        {
+            int next = neighbors[i];
+
+            if ((grid.cells[next] != MAZE_CELL_WALL) && (distances[next] > nextDistance))
+            {
+                distances[next] = nextDistance;
+                queue[queueEnd++] = next;
+            }
+        }
+    }
+}
+
+// Get best distance from cell neighbors (lowest neighbor distance + 1), MAZE_DISTANCE_UNREACHABLE if none reachable
+static unsigned int GetNeighborsDistance(MazeDistanceField *field, int index)
+{
+    unsigned int best = MAZE_DISTANCE_UNREACHABLE;
+    int neighbors[4] = { 0 };
+    int count = GetCellNeighbors(field->width, field->height, index, neighbors);
+
+    for (int i = 0; i < count; i++)
+    {
+        if (field->distances[neighbors[i]] < best) best = field->distances[neighbors[i]] + 1;
+    }
+
+    return best;
+}
+
+// Compare seeds by distance, for qsort()
+static int CompareDistanceSeeds(const void *a, const void *b)
+{
+    unsigned int da = ((const DistanceSeed *)a)->distance;
+    unsigned int db = ((const DistanceSeed *)b)->distance;
+
+    return (da > db) - (da < db);
+}
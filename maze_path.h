@@ -0,0 +1,66 @@
+/*******************************************************************************************
+*
+*   maze_path - Maze distance fields for reachability and shortest path queries
+*
+*   A distance field stores, for every cell, the number of steps to its source cell
+*   (4-connected moves, walls block), computed once with a BFS and updated incrementally
+*   when cells change, so reachability and path length queries are a single array access
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#ifndef MAZE_PATH_H
+#define MAZE_PATH_H
+
+#include "maze_grid.h"      // Required for: MazeGrid, Point, MazeArena
+
+#define MAZE_DISTANCE_UNREACHABLE   0xffffffffu     // Distance value for cells not reachable from source
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Maze distance field, steps from every cell to source cell
+typedef struct MazeDistanceField {
+    int width;                  // Field width, same as grid
+    int height;                 // Field height, same as grid
+    Point source;               // Source cell, distance 0
+    unsigned int *distances;    // Distance to source for every cell, row-major
+    int *queue;                 // Cells queue for BFS, allocated once for incremental updates
+} MazeDistanceField;
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+MazeDistanceField LoadMazeDistanceField(MazeGrid grid, Point source);                   // Load distance field, computing distances to source
+MazeDistanceField LoadMazeDistanceFieldArena(MazeArena *arena, MazeGrid grid, Point source);    // Load distance field, with all memory taken from arena
+void UnloadMazeDistanceField(MazeDistanceField field);                                  // Unload distance field from memory (RAM)
+void ResetMazeDistanceField(MazeDistanceField *field, MazeGrid grid);                   // Reset distance field, computing again all distances (no reallocation)
+void UpdateMazeDistanceField(MazeDistanceField *field, MazeGrid grid, Point cell);      // Update distances after a cell changed in grid (incremental)
+void UpdateMazeDistanceFieldCells(MazeDistanceField *field, MazeGrid grid, const Point *cells, int count);  // Update distances after several cells changed in grid (incremental, all cells at once)
+void SetMazeDistanceFieldSource(MazeDistanceField *field, MazeGrid grid, Point source); // Set field source cell, distances computed again only if source changed
+
+int GetMazePath(MazeDistanceField field, Point from, Point *path, int maxLength);        // Get shortest path cells from a cell to source, returns path length
+
+// Get steps from cell to field source, MAZE_DISTANCE_UNREACHABLE if not reachable
+static inline unsigned int GetMazeDistance(MazeDistanceField field, int x, int y)
+{
+    return (((unsigned int)x < (unsigned int)field.width) && ((unsigned int)y < (unsigned int)field.height))?
+        field.distances[y*field.width + x] : MAZE_DISTANCE_UNREACHABLE;
+}
+
+// Check if cell can reach field source
+static inline bool IsMazeCellReachable(MazeDistanceField field, int x, int y)
+{
+    return (GetMazeDistance(field, x, y) != MAZE_DISTANCE_UNREACHABLE);
+}
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // MAZE_PATH_H
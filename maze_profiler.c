@@ -0,0 +1,329 @@
+/*******************************************************************************************
+*
+*   maze_profiler - Per-phase frame profiler, rolling percentiles and metrics export
+*
+*   NOTE: Timer is independent from raylib GetTime(), profiler can be used with no window,
+*   monotonic clock is used so system time adjustments do not affect measures
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+    #define _POSIX_C_SOURCE 199309L     // Required for: clock_gettime(), CLOCK_MONOTONIC
+#endif
+
+#include "maze_profiler.h"
+
+#include <stdio.h>          // Required for: FILE, fopen(), fprintf(), fclose()
+#include <stdlib.h>         // Required for: qsort()
+#include <string.h>         // Required for: strncpy(), strcmp(), strrchr(), memcpy()
+
+#if defined(_WIN32)
+    // NOTE: Declared here, win32 headers conflict with raylib names
+    __declspec(dllimport) int __stdcall QueryPerformanceCounter(unsigned long long int *lpPerformanceCount);
+    __declspec(dllimport) int __stdcall QueryPerformanceFrequency(unsigned long long int *lpFrequency);
+#else
+    #include <time.h>       // Required for: clock_gettime()
+#endif
+
+#define MAX_PROFILE_NAME    32
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Profiler data
+typedef struct MazeProfiler {
+    int scopeCount;
+    int counterCount;
+    char scopeNames[MAX_PROFILE_SCOPES][MAX_PROFILE_NAME];
+    char counterNames[MAX_PROFILE_COUNTERS][MAX_PROFILE_NAME];
+
+    double frameStart;                                          // Current frame start time (seconds)
+    double scopeStart[MAX_PROFILE_SCOPES];                      // Current scopes start time (seconds)
+    float scopeTime[MAX_PROFILE_SCOPES];                        // Current frame scopes time (milliseconds)
+    int counterValue[MAX_PROFILE_COUNTERS];                     // Current frame counters
+
+    int frameCount;                                             // Frames profiled in session
+    float frameHistory[PROFILE_HISTORY_FRAMES];                 // Frame times ring buffer (milliseconds)
+    float scopeHistory[MAX_PROFILE_SCOPES][PROFILE_HISTORY_FRAMES];
+    float counterHistory[MAX_PROFILE_COUNTERS][PROFILE_HISTORY_FRAMES];
+
+    double totalTime;                                           // Session frames time (milliseconds)
+    int worstFrame;                                             // Session worst frame index
+    float worstFrameTime;                                       // Session worst frame time (milliseconds)
+    float worstFrameScopes[MAX_PROFILE_SCOPES];                 // Session worst frame scopes time (milliseconds)
+} MazeProfiler;
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static MazeProfiler profiler = { 0 };
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Declaration
+//----------------------------------------------------------------------------------
+static ProfileStats GetHistoryStats(const float *history);          // Get rolling stats from history ring buffer
+static int CompareFloats(const void *a, const void *b);
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Init profiler, clearing all scopes, counters and history
+void InitMazeProfiler(void)
+{
+    memset(&profiler, 0, sizeof(MazeProfiler));
+    profiler.worstFrame = -1;
+}
+
+// Register timed scope, returns scope id, -1 on failure
+int AddProfileScope(const char *name)
+{
+    if (profiler.scopeCount >= MAX_PROFILE_SCOPES) return -1;
+
+    strncpy(profiler.scopeNames[profiler.scopeCount], name, MAX_PROFILE_NAME - 1);
+
+    return profiler.scopeCount++;
+}
+
+// Register per-frame counter, returns counter id, -1 on failure
+int AddProfileCounter(const char *name)
+{
+    if (profiler.counterCount >= MAX_PROFILE_COUNTERS) return -1;
+
+    strncpy(profiler.counterNames[profiler.counterCount], name, MAX_PROFILE_NAME - 1);
+
+    return profiler.counterCount++;
+}
+
+// Begin frame timing, clearing current frame scopes and counters
+void BeginProfileFrame(void)
+{
+    memset(profiler.scopeTime, 0, sizeof(profiler.scopeTime));
+    memset(profiler.counterValue, 0, sizeof(profiler.counterValue));
+
+    profiler.frameStart = GetMazeTime();
+}
+
+// End frame timing, storing frame in history
+void EndProfileFrame(void)
+{
+    float frameTime = (float)((GetMazeTime() - profiler.frameStart)*1000.0);
+    int slot = profiler.frameCount%PROFILE_HISTORY_FRAMES;
+
+    profiler.frameHistory[slot] = frameTime;
+    for (int i = 0; i < profiler.scopeCount; i++) profiler.scopeHistory[i][slot] = profiler.scopeTime[i];
+    for (int i = 0; i < profiler.counterCount; i++) profiler.counterHistory[i][slot] = (float)profiler.counterValue[i];
+
+    // Keep worst frame scopes, to know what caused the hitch
+    if (frameTime > profiler.worstFrameTime)
+    {
+        profiler.worstFrame = profiler.frameCount;
+        profiler.worstFrameTime = frameTime;
+        memcpy(profiler.worstFrameScopes, profiler.scopeTime, sizeof(profiler.scopeTime));
+    }
+
+    profiler.totalTime += frameTime;
+    profiler.frameCount++;
+}
+
+// Begin scope timing
+void BeginProfileScope(int scope)
+{
+    if ((scope < 0) || (scope >= profiler.scopeCount)) return;
+
+    profiler.scopeStart[scope] = GetMazeTime();
+}
+
+// End scope timing, time added to current frame
+void EndProfileScope(int scope)
+{
+    if ((scope < 0) || (scope >= profiler.scopeCount)) return;
+
+    profiler.scopeTime[scope] += (float)((GetMazeTime() - profiler.scopeStart[scope])*1000.0);
+}
+
+// Add amount to counter, for current frame
+void AddProfileCount(int counter, int amount)
+{
+    if ((counter < 0) || (counter >= profiler.counterCount)) return;
+
+    profiler.counterValue[counter] += amount;
+}
+
+// Get frame time stats (milliseconds)
+ProfileStats GetProfileFrameStats(void)
+{
+    return GetHistoryStats(profiler.frameHistory);
+}
+
+// Get scope time stats (milliseconds)
+ProfileStats GetProfileScopeStats(int scope)
+{
+    if ((scope < 0) || (scope >= profiler.scopeCount)) return (ProfileStats){ 0 };
+
+    return GetHistoryStats(profiler.scopeHistory[scope]);
+}
+
+// Get counter stats (per frame)
+ProfileStats GetProfileCounterStats(int counter)
+{
+    if ((counter < 0) || (counter >= profiler.counterCount)) return (ProfileStats){ 0 };
+
+    return GetHistoryStats(profiler.counterHistory[counter]);
+}
+
+// Draw profiler overlay (stats table)
+void DrawMazeProfiler(int posX, int posY)
+{
+    const int fontSize = 10;
+    const int lineHeight = 12;
+    int lines = 3 + profiler.scopeCount + profiler.counterCount;
+
+    DrawRectangle(posX, posY, 330, lines*lineHeight + 8, Fade(BLACK, 0.75f));
+
+    int y = posY + 4;
+    ProfileStats frame = GetProfileFrameStats();
+
+    DrawText(TextFormat("FRAME ms  p50 %6.2f  p95 %6.2f  p99 %6.2f", frame.p50, frame.p95, frame.p99), posX + 4, y, fontSize, YELLOW);
+    y += lineHeight;
+    DrawText(TextFormat("WORST ms  %6.2f (frame %i)", profiler.worstFrameTime, profiler.worstFrame), posX + 4, y, fontSize, YELLOW);
+    y += lineHeight;
+    DrawText("SCOPE ms           avg      p95      max", posX + 4, y, fontSize, LIGHTGRAY);
+    y += lineHeight;
+
+    for (int i = 0; i < profiler.scopeCount; i++, y += lineHeight)
+    {
+        ProfileStats stats = GetHistoryStats(profiler.scopeHistory[i]);
+        DrawText(TextFormat("%-16s %7.3f  %7.3f  %7.3f", profiler.scopeNames[i], stats.avg, stats.p95, stats.max), posX + 4, y, fontSize, WHITE);
+    }
+
+    for (int i = 0; i < profiler.counterCount; i++, y += lineHeight)
+    {
+        ProfileStats stats = GetHistoryStats(profiler.counterHistory[i]);
+        DrawText(TextFormat("%-16s %7.1f  %7.1f  %7.1f", profiler.counterNames[i], stats.avg, stats.p95, stats.max), posX + 4, y, fontSize, SKYBLUE);
+    }
+}
+
+// Export profiler data: .json stats summary, otherwise CSV history frames
+bool ExportMazeProfiler(const char *fileName)
+{
+    FILE *file = fopen(fileName, "wt");
+    if (file == NULL) return false;
+
+    const char *extension = strrchr(fileName, '.');
+
+    if ((extension != NULL) && (strcmp(extension, ".json") == 0))
+    {
+        ProfileStats frame = GetProfileFrameStats();
+
+        fprintf(file, "{\n");
+        fprintf(file, "    \"frames\": %i,\n", profiler.frameCount);
+        fprintf(file, "    \"avg_frame_ms\": %.4f,\n", (profiler.frameCount > 0)? profiler.totalTime/profiler.frameCount : 0.0);
+        fprintf(file, "    \"frame_ms\": { \"avg\": %.4f, \"p50\": %.4f, \"p95\": %.4f, \"p99\": %.4f, \"max\": %.4f },\n", frame.avg, frame.p50, frame.p95, frame.p99, frame.max);
+
+        fprintf(file, "    \"worst_frame\": { \"frame\": %i, \"ms\": %.4f, \"scopes_ms\": {", profiler.worstFrame, profiler.worstFrameTime);
+        for (int i = 0; i < profiler.scopeCount; i++) fprintf(file, "%s \"%s\": %.4f", (i > 0)? "," : "", profiler.scopeNames[i], profiler.worstFrameScopes[i]);
+        fprintf(file, " } },\n");
+
+        fprintf(file, "    \"scopes_ms\": {\n");
+        for (int i = 0; i < profiler.scopeCount; i++)
+        {
+            ProfileStats stats = GetHistoryStats(profiler.scopeHistory[i]);
+            fprintf(file, "        \"%s\": { \"avg\": %.4f, \"p50\": %.4f, \"p95\": %.4f, \"p99\": %.4f, \"max\": %.4f }%s\n",
+                profiler.scopeNames[i], stats.avg, stats.p50, stats.p95, stats.p99, stats.max, (i < (profiler.scopeCount - 1))? "," : "");
+        }
+        fprintf(file, "    },\n");
+
+        fprintf(file, "    \"counters_per_frame\": {\n");
+        for (int i = 0; i < profiler.counterCount; i++)
+        {
+            ProfileStats stats = GetHistoryStats(profiler.counterHistory[i]);
+            fprintf(file, "        \"%s\": { \"avg\": %.2f, \"p50\": %.0f, \"p95\": %.0f, \"p99\": %.0f, \"max\": %.0f }%s\n",
+                profiler.counterNames[i], stats.avg, stats.p50, stats.p95, stats.p99, stats.max, (i < (profiler.counterCount - 1))? "," : "");
+        }
+        fprintf(file, "    }\n");
+        fprintf(file, "}\n");
+    }
+    else
+    {
+        // History frames, oldest first
+        fprintf(file, "frame,frame_ms");
+        for (int i = 0; i < profiler.scopeCount; i++) fprintf(file, ",%s_ms", profiler.scopeNames[i]);
+        for (int i = 0; i < profiler.counterCount; i++) fprintf(file, ",%s", profiler.counterNames[i]);
+        fprintf(file, "\n");
+
+        int first = (profiler.frameCount > PROFILE_HISTORY_FRAMES)? profiler.frameCount - PROFILE_HISTORY_FRAMES : 0;
+
+        for (int f = first; f < profiler.frameCount; f++)
+        {
+            int slot = f%PROFILE_HISTORY_FRAMES;
+
+            fprintf(file, "%i,%.4f", f, profiler.frameHistory[slot]);
+            for (int i = 0; i < profiler.scopeCount; i++) fprintf(file, ",%.4f", profiler.scopeHistory[i][slot]);
+            for (int i = 0; i < profiler.counterCount; i++) fprintf(file, ",%.0f", profiler.counterHistory[i][slot]);
+            fprintf(file, "\n");
+        }
+    }
+
+    return (fclose(file) == 0);
+}
+
+// Get monotonic time in seconds, no window required
+double GetMazeTime(void)
+{
+#if defined(_WIN32)
+    static unsigned long long int frequency = 0;
+    unsigned long long int counter = 0;
+
+    if (frequency == 0) QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+
+    return (double)counter/(double)frequency;
+#else
+    struct timespec now = { 0 };
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (double)now.tv_sec + (double)now.tv_nsec*1e-9;
+#endif
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+// Get rolling stats from history ring buffer, only frames already stored are considered
+static ProfileStats GetHistoryStats(const float *history)
+{
+    ProfileStats stats = { 0 };
+    int count = (profiler.frameCount < PROFILE_HISTORY_FRAMES)? profiler.frameCount : PROFILE_HISTORY_FRAMES;
+
+    if (count == 0) return stats;
+
+    static float sorted[PROFILE_HISTORY_FRAMES] = { 0 };
+    double sum = 0.0;
+
+    for (int i = 0; i < count; i++)
+    {
+        sorted[i] = history[i];
+        sum += history[i];
+    }
+
+    qsort(sorted, count, sizeof(float), CompareFloats);
+
+    stats.avg = (float)(sum/count);
+    stats.p50 = sorted[(count - 1)*50/100];
+    stats.p95 = sorted[(count - 1)*95/100];
+    stats.p99 = sorted[(count - 1)*99/100];
+    stats.max = sorted[count - 1];
+
+    return stats;
+}
+
+// Compare floats, for qsort()
+static int CompareFloats(const void *a, const void *b)
+{
+    float fa = *(const float *)a;
+    float fb = *(const float *)b;
+
+    return (fa > fb) - (fa < fb);
+}
@@ -0,0 +1,67 @@
+/*******************************************************************************************
+*
+*   maze_profiler - Per-phase frame profiler, rolling percentiles and metrics export
+*
+*   Named scopes are timed every frame (accumulated if a scope runs several times
+*   in a frame) and named counters are summed per frame; last PROFILE_HISTORY_FRAMES
+*   frames are kept for rolling percentile stats, worst frame of the session is also kept
+*
+*   NOTE: Times are CPU times, GPU work is only measured where it blocks the CPU
+*   (i.e. batch submission, buffer swap)
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#ifndef MAZE_PROFILER_H
+#define MAZE_PROFILER_H
+
+#include "raylib.h"
+
+#define MAX_PROFILE_SCOPES          16
+#define MAX_PROFILE_COUNTERS        8
+#define PROFILE_HISTORY_FRAMES      600     // Frames kept for rolling stats (10 seconds at 60 fps)
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Rolling stats, over history frames
+typedef struct ProfileStats {
+    float avg;                  // Average value
+    float p50;                  // 50th percentile (median)
+    float p95;                  // 95th percentile
+    float p99;                  // 99th percentile
+    float max;                  // Max value
+} ProfileStats;
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+void InitMazeProfiler(void);                                    // Init profiler, clearing all scopes, counters and history
+int AddProfileScope(const char *name);                          // Register timed scope, returns scope id, -1 on failure
+int AddProfileCounter(const char *name);                        // Register per-frame counter, returns counter id, -1 on failure
+
+void BeginProfileFrame(void);                                   // Begin frame timing, clearing current frame scopes and counters
+void EndProfileFrame(void);                                     // End frame timing, storing frame in history
+void BeginProfileScope(int scope);                              // Begin scope timing
+void EndProfileScope(int scope);                                // End scope timing, time added to current frame
+void AddProfileCount(int counter, int amount);                  // Add amount to counter, for current frame
+
+ProfileStats GetProfileFrameStats(void);                        // Get frame time stats (milliseconds)
+ProfileStats GetProfileScopeStats(int scope);                   // Get scope time stats (milliseconds)
+ProfileStats GetProfileCounterStats(int counter);               // Get counter stats (per frame)
+
+void DrawMazeProfiler(int posX, int posY);                      // Draw profiler overlay (stats table)
+bool ExportMazeProfiler(const char *fileName);                  // Export profiler data: .json stats summary, otherwise CSV history frames
+
+double GetMazeTime(void);                                       // Get monotonic time in seconds, no window required
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // MAZE_PROFILER_H
@@ -0,0 +1,200 @@
+/*******************************************************************************************
+*
+*   maze_render - Maze cells rendering: tiles batching and maze texture (one pixel per cell)
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "maze_render.h"
+
+#include "rlgl.h"       // Required for: rlSetTexture(), rlBegin(), rlVertex2f(), rlTextureParameters()...
+
+#include <stdlib.h>     // Required for: malloc(), free()
+#include <math.h>       // Required for: floorf(), fminf(), fmaxf()
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Draw maze cells visible by camera, using current biome atlas
+// NOTE: Atlas is divided in 4 tiles: [item, exit] top row, [wall, floor] bottom row
+// If visibility is provided, unexplored cells are skipped (whole bitset words at once)
+// and explored cells out of view are darkened, returns render batches used (draw calls issued)
+int DrawMazeTiles(MazeGrid grid, Texture texAtlas, Vector2 position, float scale, Camera2D camera, const MazeVisibility *visibility)
+{
+    // Atlas tile (normalized texture coordinates) for every cell kind
+    static const Vector2 cellTiles[MAZE_CELL_KINDS] = {
+        { 0.5f, 0.5f },     // MAZE_CELL_FLOOR
+        { 0.0f, 0.5f },     // MAZE_CELL_WALL
+        { 0.0f, 0.0f },     // MAZE_CELL_ITEM
+        { 0.5f, 0.0f },     // MAZE_CELL_EXIT
+    };
+
+    Rectangle view = GetCameraViewArea(camera);
+
+    // Get visible cells range, clamped to maze limits
+    int startX = (int)floorf((view.x - position.x)/scale);
+    int startY = (int)floorf((view.y - position.y)/scale);
+    int endX = (int)floorf((view.x + view.width - position.x)/scale);
+    int endY = (int)floorf((view.y + view.height - position.y)/scale);
+
+    if (startX < 0) startX = 0;
+    if (startY < 0) startY = 0;
+    if (endX > (grid.width - 1)) endX = grid.width - 1;
+    if (endY > (grid.height - 1)) endY = grid.height - 1;
+
+    if ((startX > endX) || (startY > endY)) return 0;
+
+    // All visible tiles are added to the same batch, using the atlas texture
+    int batches = 1;
+    rlSetTexture(texAtlas.id);
+    rlBegin(RL_QUADS);
+
+        rlColor4ub(255, 255, 255, 255);
+        rlNormal3f(0.0f, 0.0f, 1.0f);
+
+        for (int y = startY; y <= endY; y++)
+        {
+            const unsigned char *row = grid.cells + y*grid.width;
+            const unsigned long long *explored = (visibility != NULL)? visibility->explored + y*visibility->wordsPerRow : NULL;
+            const unsigned long long *visible = (visibility != NULL)? visibility->visible + y*visibility->wordsPerRow : NULL;
+
+            for (int x = startX; x <= endX; x++)
+            {
+                if (explored != NULL)
+                {
+                    unsigned long long exploredBits = explored[x >> 6] >> (x & 63);
+
+                    // No cell explored in the rest of the word, skip to next word
+                    if (exploredBits == 0)
+                    {
+                        x |= 63;
+                        continue;
+                    }
+                    else if ((exploredBits & 1) == 0) continue;
+
+                    if ((visible[x >> 6] >> (x & 63)) & 1) rlColor4ub(255, 255, 255, 255);
+                    else rlColor4ub(MAZE_EXPLORED_SHADE, MAZE_EXPLORED_SHADE, MAZE_EXPLORED_SHADE, 255);
+                }
+
+                Vector2 tile = cellTiles[row[x] & 0x03];
+
+                float left = position.x + x*scale;
+                float top = position.y + y*scale;
+
+                // Make sure there is space in current batch for another quad,
+                // if not, batch is drawn and a new one started with same texture
+                if (rlCheckRenderBatchLimit(4)) batches++;
+
+                rlTexCoord2f(tile.x, tile.y);
+                rlVertex2f(left, top);
+
+                rlTexCoord2f(tile.x, tile.y + 0.5f);
+                rlVertex2f(left, top + scale);
+
+                rlTexCoord2f(tile.x + 0.5f, tile.y + 0.5f);
+                rlVertex2f(left + scale, top + scale);
+
+                rlTexCoord2f(tile.x + 0.5f, tile.y);
+                rlVertex2f(left + scale, top);
+            }
+        }
+
+    rlEnd();
+    rlSetTexture(0);
+
+    return batches;
+}
+
+// Get world area covered by the screen for camera
+// NOTE: All screen corners are considered, in case camera is rotated
+Rectangle GetCameraViewArea(Camera2D camera)
+{
+    Vector2 corners[4] = {
+        GetScreenToWorld2D((Vector2){ 0, 0 }, camera),
+        GetScreenToWorld2D((Vector2){ (float)GetScreenWidth(), 0 }, camera),
+        GetScreenToWorld2D((Vector2){ 0, (float)GetScreenHeight() }, camera),
+        GetScreenToWorld2D((Vector2){ (float)GetScreenWidth(), (float)GetScreenHeight() }, camera),
+    };
+
+    Vector2 viewMin = corners[0];
+    Vector2 viewMax = corners[0];
+
+    for (int i = 1; i < 4; i++)
+    {
+        viewMin.x = fminf(viewMin.x, corners[i].x);
+        viewMin.y = fminf(viewMin.y, corners[i].y);
+        viewMax.x = fmaxf(viewMax.x, corners[i].x);
+        viewMax.y = fmaxf(viewMax.y, corners[i].y);
+    }
+
+    return (Rectangle){ viewMin.x, viewMin.y, viewMax.x - viewMin.x, viewMax.y - viewMin.y };
+}
+
+// Add cells area to dirty region, pending to be updated in texture
+void AddMazeDirtyRegion(MazeDirtyRegion *region, int minX, int minY, int maxX, int maxY)
+{
+    if (!region->dirty)
+    {
+        *region = (MazeDirtyRegion){ true, minX, minY, maxX, maxY };
+    }
+    else
+    {
+        if (minX < region->minX) region->minX = minX;
+        if (minY < region->minY) region->minY = minY;
+        if (maxX > region->maxX) region->maxX = maxX;
+        if (maxY > region->maxY) region->maxY = maxY;
+    }
+}
+
+// Load maze texture from grid cells (one pixel per cell), mipmapped for zoomed out drawing
+// NOTE: Cells are kept sharp when texture is magnified (editor, zoomed in) and filtered
+// using mipmaps when minified (zoomed out, minimap), avoiding aliasing on big mazes
+Texture LoadMazeTexture(MazeGrid grid)
+{
+    Image imMaze = GenImageFromMazeGrid(grid);
+    Texture texMaze = LoadTextureFromImage(imMaze);
+    UnloadImage(imMaze);        // Image data not required any more, grid is the maze model
+
+    GenTextureMipmaps(&texMaze);
+    rlTextureParameters(texMaze.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_MIP_LINEAR);
+    rlTextureParameters(texMaze.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_NEAREST);
+
+    return texMaze;
+}
+
+// Update maze texture with dirty region cells only (no texture reallocation)
+// NOTE: Only base level is updated, mipmaps are left outdated: they must be generated again
+// (GenTextureMipmaps()) before texture is drawn minified, once for all updates done until then
+void UpdateMazeTexture(Texture texMaze, MazeGrid grid, MazeDirtyRegion *region)
+{
+    if (!region->dirty) return;
+
+    int width = region->maxX - region->minX + 1;
+    int height = region->maxY - region->minY + 1;
+
+    if ((width <= 0) || (height <= 0))
+    {
+        region->dirty = false;
+        return;
+    }
+    Rectangle rec = { (float)region->minX, (float)region->minY, (float)width, (float)height };
+
+    // Convert region cells into display colors, in a contiguous buffer,
+    // small regions (i.e. single cells edited) use stack memory
+    Color stackPixels[256];
+    Color *regionPixels = ((width*height) <= 256)? stackPixels : (Color *)malloc(width*height*sizeof(Color));
+
+    for (int y = 0; y < height; y++)
+    {
+        const unsigned char *row = grid.cells + (region->minY + y)*grid.width + region->minX;
+
+        for (int x = 0; x < width; x++) regionPixels[y*width + x] = GetMazeCellColor((MazeCell)row[x]);
+    }
+
+    UpdateTextureRec(texMaze, rec, regionPixels);
+
+    if (regionPixels != stackPixels) free(regionPixels);
+
+    region->dirty = false;
+}
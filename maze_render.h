@@ -0,0 +1,57 @@
+/*******************************************************************************************
+*
+*   maze_render - Maze cells rendering: tiles batching and maze texture (one pixel per cell)
+*
+*   Tiles: only cells visible by camera are drawn, all of them added to the same render
+*   batch from one atlas texture, so draw calls only depend on batch size, not on maze size
+*
+*   Maze texture: cells changed are registered in a dirty region, only that region is
+*   converted and uploaded, once per frame, no texture reallocation; mipmaps are only
+*   generated again by the caller when texture is going to be drawn minified
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#ifndef MAZE_RENDER_H
+#define MAZE_RENDER_H
+
+#include "raylib.h"
+#include "maze_grid.h"          // Required for: MazeGrid
+#include "maze_visibility.h"    // Required for: MazeVisibility
+
+#define MAZE_EXPLORED_SHADE     100     // Explored cells out of view drawn darkened, color scale [0..255]
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Maze grid region modified since last texture update, in cells
+typedef struct MazeDirtyRegion {
+    bool dirty;
+    int minX;
+    int minY;
+    int maxX;
+    int maxY;
+} MazeDirtyRegion;
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+// Draw maze cells visible by camera, all tiles sent to GPU as a single batch, returns render batches used
+// NOTE: If visibility is provided, unexplored cells are skipped and explored cells out of view darkened
+int DrawMazeTiles(MazeGrid grid, Texture texAtlas, Vector2 position, float scale, Camera2D camera, const MazeVisibility *visibility);
+Rectangle GetCameraViewArea(Camera2D camera);                                              // Get world area covered by the screen for camera
+
+void AddMazeDirtyRegion(MazeDirtyRegion *region, int minX, int minY, int maxX, int maxY);  // Add cells area to dirty region, pending to be updated in texture
+Texture LoadMazeTexture(MazeGrid grid);                                                     // Load maze texture from grid cells (one pixel per cell), mipmapped for zoomed out drawing
+void UpdateMazeTexture(Texture texMaze, MazeGrid grid, MazeDirtyRegion *region);           // Update maze texture with dirty region cells only (no texture reallocation), mipmaps left outdated
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // MAZE_RENDER_H
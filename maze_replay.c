@@ -0,0 +1,94 @@
+/*******************************************************************************************
+*
+*   maze_replay - Input recording and replay files
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "maze_replay.h"
+
+#include <stdio.h>          // Required for: FILE, fopen(), fread(), fwrite(), fclose()
+#include <stdlib.h>         // Required for: malloc(), realloc(), free()
+#include <string.h>         // Required for: memcmp()
+
+#define MIN_REPLAY_CAPACITY     1024
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Load replay from file, frames is NULL on failure
+MazeReplay LoadMazeReplay(const char *fileName)
+{
+    MazeReplay replay = { 0 };
+
+    FILE *file = fopen(fileName, "rb");
+    if (file == NULL) return replay;
+
+    char id[4] = { 0 };
+    unsigned int version = 0;
+    int frameCount = 0;
+
+    if ((fread(id, 1, 4, file) == 4) && (memcmp(id, "MRPL", 4) == 0) &&
+        (fread(&version, sizeof(unsigned int), 1, file) == 1) && (version == MAZE_REPLAY_VERSION) &&
+        (fread(&frameCount, sizeof(int), 1, file) == 1) && (frameCount > 0))
+    {
+        replay.frames = (MazeReplayFrame *)malloc((size_t)frameCount*sizeof(MazeReplayFrame));
+
+        if ((replay.frames != NULL) && (fread(replay.frames, sizeof(MazeReplayFrame), frameCount, file) == (size_t)frameCount))
+        {
+            replay.frameCount = frameCount;
+            replay.capacity = frameCount;
+        }
+        else
+        {
+            free(replay.frames);
+            replay.frames = NULL;
+        }
+    }
+
+    fclose(file);
+
+    return replay;
+}
+
+// Unload replay frames from memory (RAM)
+void UnloadMazeReplay(MazeReplay replay)
+{
+    free(replay.frames);
+}
+
+// Save replay to file, returns true on success
+bool SaveMazeReplay(const char *fileName, MazeReplay replay)
+{
+    FILE *file = fopen(fileName, "wb");
+    if (file == NULL) return false;
+
+    unsigned int version = MAZE_REPLAY_VERSION;
+
+    bool success = (fwrite("MRPL", 1, 4, file) == 4) &&
+        (fwrite(&version, sizeof(unsigned int), 1, file) == 1) &&
+        (fwrite(&replay.frameCount, sizeof(int), 1, file) == 1) &&
+        (fwrite(replay.frames, sizeof(MazeReplayFrame), replay.frameCount, file) == (size_t)replay.frameCount);
+
+    if (fclose(file) != 0) success = false;
+
+    return success;
+}
+
+// Add frame to replay, growing memory as required
+void AddMazeReplayFrame(MazeReplay *replay, MazeReplayFrame frame)
+{
+    if (replay->frameCount >= replay->capacity)
+    {
+        int capacity = (replay->capacity > 0)? replay->capacity*2 : MIN_REPLAY_CAPACITY;
+        MazeReplayFrame *frames = (MazeReplayFrame *)realloc(replay->frames, (size_t)capacity*sizeof(MazeReplayFrame));
+
+        if (frames == NULL) return;
+
+        replay->frames = frames;
+        replay->capacity = capacity;
+    }
+
+    replay->frames[replay->frameCount++] = frame;
+}
@@ -0,0 +1,56 @@
+/*******************************************************************************************
+*
+*   maze_replay - Input recording and replay files
+*
+*   Every frame input (actions flags, mouse position) is recorded with the frame time
+*   used by the simulation, so feeding frames back through the same update code
+*   reproduces the same ticks and the same game state
+*
+*   File layout (native byte order): "MRPL" id, version, frame count, frames
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#ifndef MAZE_REPLAY_H
+#define MAZE_REPLAY_H
+
+#include "raylib.h"
+
+#define MAZE_REPLAY_VERSION     1
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Recorded frame
+typedef struct MazeReplayFrame {
+    float frameTime;                // Frame time fed to simulation (seconds)
+    unsigned int actionsDown;       // Actions held down (game action flags)
+    unsigned int actionsPressed;    // Actions pressed on frame (game action flags)
+    Vector2 mousePosition;          // Mouse position in screen coordinates
+} MazeReplayFrame;
+
+// Input recording
+typedef struct MazeReplay {
+    int frameCount;                 // Frames recorded
+    int capacity;                   // Frames allocated
+    MazeReplayFrame *frames;        // Recorded frames
+} MazeReplay;
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+MazeReplay LoadMazeReplay(const char *fileName);                            // Load replay from file, frames is NULL on failure
+void UnloadMazeReplay(MazeReplay replay);                                   // Unload replay frames from memory (RAM)
+bool SaveMazeReplay(const char *fileName, MazeReplay replay);               // Save replay to file, returns true on success
+void AddMazeReplayFrame(MazeReplay *replay, MazeReplayFrame frame);         // Add frame to replay, growing memory as required
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // MAZE_REPLAY_H
@@ -0,0 +1,527 @@
+/*******************************************************************************************
+*
+*   maze_stats - Maze analytics: cell counts, dead ends, corridors and connected regions
+*
+*   Bitmask kernels, for every word W of walkable cells (bit i = cell x):
+*     - Packing: 8 cells compared at once (SWAR), non-wall bytes flags gathered with a multiply
+*     - Left/right neighbors: W shifted by one bit, carrying the bit of previous/next word
+*     - Up/down neighbors: same word of previous/next row
+*     - Walkable neighbors count: bit-sliced adders of the 4 neighbors masks (3 bits count
+*       for 64 cells at once), dead ends are count 1, junctions count 3 or more
+*     - Straight corridors: run starts (W & ~left & right) and run cells (W & (left | right))
+*
+*   Connected regions and corridors max length are also computed by bands: every band
+*   merges its own runs (run ids are global, taken from runs counted while packing),
+*   then runs across bands edges are merged and vertical corridors joined sequentially,
+*   only visiting one row pair and one value per column for every band edge
+*
+*   NOTE: Row padding bits (cells after grid width) are always clear, cells out of grid are walls
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "maze_stats.h"
+#include "maze_jobs.h"      // Required for: RunMazeJobs()
+
+#include <stdlib.h>         // Required for: malloc(), calloc(), free()
+#include <string.h>         // Required for: memcpy()
+
+#define VERTICAL_RUN_THROUGH    -1      // Band vertical run value: column run crosses the whole band
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Cell counts of one band of rows
+typedef struct MazeStatsCounts {
+    int walkable;
+    int items;
+    int deadEnds;
+    int junctions;
+    int corridors;
+    int corridorCells;
+    int corridorMaxLength;      // Max length of corridors fully inside band
+    int runs;                   // Horizontal runs of walkable cells (any length)
+    int unions;                 // Runs merged into a connected region
+} MazeStatsCounts;
+
+// Analysis data, shared by all bands
+typedef struct MazeStatsBands {
+    MazeGrid grid;
+    int wordsPerRow;
+    int bandCount;
+    unsigned long long *walkable;   // Walkable cells bitmask, rows padded to full words
+    MazeStatsCounts *counts;        // Counts for every band
+    int *runBases;                  // First run id of every band
+    int *parents;                   // Runs union-find parent run
+    int *sizes;                     // Runs union-find region size (valid for root runs), in cells
+    int *topRuns;                   // Every band: vertical run length from band top, continued from band above (by column)
+    int *bottomRuns;                // Every band: vertical run length to band bottom, continued in band below (by column)
+} MazeStatsBands;
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Declaration
+//----------------------------------------------------------------------------------
+static inline int PopCount64(unsigned long long bits);             // Get set bits count
+static inline int CountTrailingZeros64(unsigned long long bits);   // Get lowest set bit index (bits must not be 0)
+
+static void PackMazeStatsBand(void *data, int band);               // Pack band rows into walkable cells bitmask, counting items and runs (job)
+static void CountMazeStatsBand(void *data, int band);              // Count band cells with bitmask kernels and merge band runs (job)
+static int GetRowRuns(const unsigned long long *row, int wordsPerRow, int *runs);  // Get horizontal runs of a bitmask row (first, last cell pairs)
+static void MergeRowRuns(MazeStatsBands *bands, const int *previousRuns, int previousCount, int previousFirst,
+                         const int *currentRuns, int currentCount, int currentFirst, int *unions);  // Merge overlapping runs of consecutive rows
+static int FindRunRoot(int *parents, int run);                     // Find connected region root run (path halving)
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Get maze statistics, if threadCount <= 0, all hardware threads are used
+// NOTE: All cells are analyzed in parallel bands, only bands edges are processed sequentially
+MazeStats GetMazeStats(MazeGrid grid, int threadCount)
+{
+    MazeStats stats = { 0 };
+
+    if ((grid.cells == NULL) || (grid.width <= 0) || (grid.height <= 0)) return stats;
+
+    MazeStatsBands bands = { 0 };
+
+    bands.grid = grid;
+    bands.wordsPerRow = (grid.width + 63)/64;
+    bands.bandCount = (grid.height + MAZE_STATS_BAND_ROWS - 1)/MAZE_STATS_BAND_ROWS;
+    bands.walkable = (unsigned long long *)malloc((size_t)bands.wordsPerRow*grid.height*sizeof(unsigned long long));
+    bands.counts = (MazeStatsCounts *)calloc(bands.bandCount, sizeof(MazeStatsCounts));
+    bands.runBases = (int *)malloc((size_t)bands.bandCount*sizeof(int));
+    bands.topRuns = (int *)malloc((size_t)bands.bandCount*grid.width*sizeof(int));
+    bands.bottomRuns = (int *)malloc((size_t)bands.bandCount*grid.width*sizeof(int));
+
+    int *rowRuns = (int *)malloc((size_t)((grid.width + 1)/2)*4*sizeof(int));  // Band edge rows runs: first and last cells
+    int *columnRuns = (int *)calloc(grid.width, sizeof(int));                   // Vertical run length reaching current band, by column
+
+    if ((bands.walkable != NULL) && (bands.counts != NULL) && (bands.runBases != NULL) &&
+        (bands.topRuns != NULL) && (bands.bottomRuns != NULL) && (rowRuns != NULL) && (columnRuns != NULL))
+    {
+        // Runs ids are assigned in rows order, every band gets its ids range once all runs are counted
+        RunMazeJobs(PackMazeStatsBand, &bands, bands.bandCount, threadCount);
+
+        int runCount = 0;
+
+        for (int b = 0; b < bands.bandCount; b++)
+        {
+            bands.runBases[b] = runCount;
+            runCount += bands.counts[b].runs;
+        }
+
+        bands.parents = (int *)malloc(((size_t)runCount + 1)*sizeof(int));
+        bands.sizes = (int *)malloc(((size_t)runCount + 1)*sizeof(int));
+    }
+
+    if ((bands.parents != NULL) && (bands.sizes != NULL))
+    {
+        // Counts require neighbor rows of other bands, all bands are packed first
+        RunMazeJobs(CountMazeStatsBand, &bands, bands.bandCount, threadCount);
+
+        MazeStatsCounts total = { 0 };
+
+        for (int b = 0; b < bands.bandCount; b++)
+        {
+            total.walkable += bands.counts[b].walkable;
+            total.items += bands.counts[b].items;
+            total.deadEnds += bands.counts[b].deadEnds;
+            total.junctions += bands.counts[b].junctions;
+            total.corridors += bands.counts[b].corridors;
+            total.corridorCells += bands.counts[b].corridorCells;
+            total.runs += bands.counts[b].runs;
+            total.unions += bands.counts[b].unions;
+
+            if (bands.counts[b].corridorMaxLength > total.corridorMaxLength) total.corridorMaxLength = bands.counts[b].corridorMaxLength;
+        }
+
+        // Bands edges: runs of band last row and next band first row merged,
+        // vertical runs crossing edges joined, by column
+        int *previousRuns = rowRuns;
+        int *currentRuns = rowRuns + ((grid.width + 1)/2)*2;
+
+        for (int b = 0; b < bands.bandCount; b++)
+        {
+            const int *topRuns = bands.topRuns + (size_t)b*grid.width;
+            const int *bottomRuns = bands.bottomRuns + (size_t)b*grid.width;
+            int bandRows = ((grid.height - b*MAZE_STATS_BAND_ROWS) < MAZE_STATS_BAND_ROWS)? (grid.height - b*MAZE_STATS_BAND_ROWS) : MAZE_STATS_BAND_ROWS;
+
+            for (int x = 0; x < grid.width; x++)
+            {
+                if (topRuns[x] == VERTICAL_RUN_THROUGH) columnRuns[x] += bandRows;
+                else
+                {
+                    int length = columnRuns[x] + topRuns[x];
+                    if (length > total.corridorMaxLength) total.corridorMaxLength = length;
+
+                    columnRuns[x] = bottomRuns[x];
+                }
+            }
+
+            if (b > 0)
+            {
+                int edgeRow = b*MAZE_STATS_BAND_ROWS;
+                const unsigned long long *row = bands.walkable + (size_t)edgeRow*bands.wordsPerRow;
+                int previousCount = GetRowRuns(row - bands.wordsPerRow, bands.wordsPerRow, previousRuns);
+                int currentCount = GetRowRuns(row, bands.wordsPerRow, currentRuns);
+
+                // Previous band last row runs are the last ids of previous band
+                MergeRowRuns(&bands, previousRuns, previousCount, bands.runBases[b] - previousCount,
+                    currentRuns, currentCount, bands.runBases[b], &total.unions);
+            }
+        }
+
+        stats.width = grid.width;
+        stats.height = grid.height;
+        stats.walkableCount = total.walkable;
+        stats.wallCount = grid.width*grid.height - total.walkable;
+        stats.itemCount = total.items;
+        stats.wallRatio = (total.walkable > 0)? (float)stats.wallCount/total.walkable : 0.0f;
+        stats.itemDensity = (total.walkable > 0)? (float)total.items/total.walkable : 0.0f;
+        stats.deadEndCount = total.deadEnds;
+        stats.junctionCount = total.junctions;
+        stats.corridorCount = total.corridors;
+        stats.corridorMeanLength = (total.corridors > 0)? (float)total.corridorCells/total.corridors : 0.0f;
+        stats.corridorMaxLength = (total.corridorMaxLength >= 2)? total.corridorMaxLength : 0;     // Single cell runs are not corridors
+        stats.componentCount = total.runs - total.unions;
+
+        for (int r = 0; r < total.runs; r++)
+        {
+            if ((bands.parents[r] == r) && (bands.sizes[r] > stats.largestComponent)) stats.largestComponent = bands.sizes[r];
+        }
+    }
+
+    free(bands.walkable);
+    free(bands.counts);
+    free(bands.runBases);
+    free(bands.parents);
+    free(bands.sizes);
+    free(bands.topRuns);
+    free(bands.bottomRuns);
+    free(rowRuns);
+    free(columnRuns);
+
+    return stats;
+}
+
+// Draw maze statistics overlay (stats table)
+void DrawMazeStats(MazeStats stats, int posX, int posY)
+{
+    const int fontSize = 10;
+    const int lineHeight = 12;
+    const int lines = 7;
+
+    DrawRectangle(posX, posY, 330, lines*lineHeight + 8, Fade(BLACK, 0.75f));
+
+    int y = posY + 4;
+
+    DrawText(TextFormat("MAZE %i x %i", stats.width, stats.height), posX + 4, y, fontSize, YELLOW);
+    y += lineHeight;
+    DrawText(TextFormat("walls %-10i walkable %-10i ratio %.3f", stats.wallCount, stats.walkableCount, stats.wallRatio), posX + 4, y, fontSize, WHITE);
+    y += lineHeight;
+    DrawText(TextFormat("items %-10i density %.4f", stats.itemCount, stats.itemDensity), posX + 4, y, fontSize, WHITE);
+    y += lineHeight;
+    DrawText(TextFormat("dead ends %-10i junctions %i", stats.deadEndCount, stats.junctionCount), posX + 4, y, fontSize, WHITE);
+    y += lineHeight;
+    DrawText(TextFormat("corridors %-10i mean %.2f  max %i", stats.corridorCount, stats.corridorMeanLength, stats.corridorMaxLength), posX + 4, y, fontSize, WHITE);
+    y += lineHeight;
+    DrawText(TextFormat("regions %-10i largest %i", stats.componentCount, stats.largestComponent), posX + 4, y, fontSize, WHITE);
+    y += lineHeight;
+
+    if (stats.componentCount > 1) DrawText(TextFormat("%i cells not connected to largest region", stats.walkableCount - stats.largestComponent), posX + 4, y, fontSize, ORANGE);
+    else DrawText("all walkable cells connected", posX + 4, y, fontSize, SKYBLUE);
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+// Get set bits count
+static inline int PopCount64(unsigned long long bits)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcountll(bits);
+#else
+    bits = bits - ((bits >> 1) & 0x5555555555555555ULL);
+    bits = (bits & 0x3333333333333333ULL) + ((bits >> 2) & 0x3333333333333333ULL);
+    bits = (bits + (bits >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+
+    return (int)((bits*0x0101010101010101ULL) >> 56);
+#endif
+}
+
+// Get lowest set bit index (bits must not be 0)
+static inline int CountTrailingZeros64(unsigned long long bits)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(bits);
+#else
+    return PopCount64((bits & (~bits + 1)) - 1);
+#endif
+}
+
+// Pack band rows into walkable cells bitmask, counting items and runs (job)
+static void PackMazeStatsBand(void *data, int band)
+{
+    MazeStatsBands *bands = (MazeStatsBands *)data;
+    MazeGrid grid = bands->grid;
+    int wordsPerRow = bands->wordsPerRow;
+    int startRow = band*MAZE_STATS_BAND_ROWS;
+    int endRow = startRow + MAZE_STATS_BAND_ROWS;
+    int items = 0;
+    int runs = 0;
+
+    if (endRow > grid.height) endRow = grid.height;
+
+    // SWAR packing assumes cells bytes order matches integer bytes order (little-endian)
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+    const bool packBytes = false;
+#else
+    const bool packBytes = true;
+#endif
+
+    for (int y = startRow; y < endRow; y++)
+    {
+        const unsigned char *cells = grid.cells + (size_t)y*grid.width;
+        unsigned long long *row = bands->walkable + (size_t)y*wordsPerRow;
+
+        for (int w = 0; w < wordsPerRow; w++)
+        {
+            int count = ((grid.width - w*64) < 64)? (grid.width - w*64) : 64;
+            const unsigned char *wordCells = cells + w*64;
+            unsigned long long bits = 0;
+            int b = 0;
+
+            if (packBytes)
+            {
+                for (; (b + 8) <= count; b += 8)
+                {
+                    unsigned long long bytes = 0;
+                    memcpy(&bytes, wordCells + b, sizeof(bytes));
+
+                    // High bit of every byte set if byte is not zero, no carries across bytes
+                    unsigned long long walls = bytes ^ (0x0101010101010101ULL*MAZE_CELL_WALL);
+                    unsigned long long itemCells = bytes ^ (0x0101010101010101ULL*MAZE_CELL_ITEM);
+                    unsigned long long walkable = (((walls & 0x7f7f7f7f7f7f7f7fULL) + 0x7f7f7f7f7f7f7f7fULL) | walls) & 0x8080808080808080ULL;
+                    unsigned long long notItems = (((itemCells & 0x7f7f7f7f7f7f7f7fULL) + 0x7f7f7f7f7f7f7f7fULL) | itemCells) & 0x8080808080808080ULL;
+
+                    // Gather bytes flags (bits 7, 15... 63) into 8 consecutive bits
+                    bits |= (((walkable >> 7)*0x0102040810204080ULL) >> 56) << b;
+                    items += 8 - PopCount64(notItems);
+                }
+            }
+
+            for (; b < count; b++)
+            {
+                bits |= (unsigned long long)(wordCells[b] != MAZE_CELL_WALL) << b;
+                items += (wordCells[b] == MAZE_CELL_ITEM);
+            }
+
+            row[w] = bits;
+        }
+
+        // Runs start on walkable cells with no walkable left neighbor
+        for (int w = 0; w < wordsPerRow; w++) runs += PopCount64(row[w] & ~((row[w] << 1) | ((w > 0)? (row[w - 1] >> 63) : 0)));
+    }
+
+    bands->counts[band].items = items;
+    bands->counts[band].runs = runs;
+}
+
+// Count band cells with bitmask kernels and merge band runs (job)
+// NOTE: Only band runs and band columns data are written, bands can be processed concurrently
+static void CountMazeStatsBand(void *data, int band)
+{
+    MazeStatsBands *bands = (MazeStatsBands *)data;
+    MazeStatsCounts *counts = &bands->counts[band];
+    int width = bands->grid.width;
+    int height = bands->grid.height;
+    int wordsPerRow = bands->wordsPerRow;
+    int startRow = band*MAZE_STATS_BAND_ROWS;
+    int endRow = startRow + MAZE_STATS_BAND_ROWS;
+
+    if (endRow > height) endRow = height;
+
+    int maxRowRuns = (width + 1)/2;
+    int *rowRuns = (int *)malloc((size_t)maxRowRuns*4*sizeof(int));      // Previous and current row runs: first and last cells
+    int *columnStarts = (int *)malloc((size_t)width*sizeof(int));        // Vertical run first row, by column
+    int *topRuns = bands->topRuns + (size_t)band*width;
+    int *bottomRuns = bands->bottomRuns + (size_t)band*width;
+
+    if ((rowRuns == NULL) || (columnStarts == NULL))
+    {
+        free(rowRuns);
+        free(columnStarts);
+        return;
+    }
+
+    const unsigned long long *aboveBand = (startRow > 0)? bands->walkable + (size_t)(startRow - 1)*wordsPerRow : NULL;  // Row above band first row
+    int *previousRuns = rowRuns;
+    int *currentRuns = rowRuns + maxRowRuns*2;
+    int previousCount = 0;
+    int runId = bands->runBases[band];
+
+    for (int x = 0; x < width; x++)
+    {
+        columnStarts[x] = startRow;
+        topRuns[x] = 0;
+        bottomRuns[x] = 0;
+    }
+
+    for (int y = startRow; y < endRow; y++)
+    {
+        const unsigned long long *row = bands->walkable + (size_t)y*wordsPerRow;
+        const unsigned long long *up = (y > 0)? row - wordsPerRow : NULL;
+        const unsigned long long *down = (y < (height - 1))? row + wordsPerRow : NULL;
+
+        for (int w = 0; w < wordsPerRow; w++)
+        {
+            unsigned long long cells = row[w];
+
+            if (cells == 0) continue;
+
+            // Neighbors masks: bit i set if neighbor of cell i is walkable
+            unsigned long long left = (cells << 1) | ((w > 0)? (row[w - 1] >> 63) : 0);
+            unsigned long long right = (cells >> 1) | ((w < (wordsPerRow - 1))? (row[w + 1] << 63) : 0);
+            unsigned long long upCells = (up != NULL)? up[w] : 0;
+            unsigned long long downCells = (down != NULL)? down[w] : 0;
+
+            // Walkable neighbors count as 3 bit slices (count = bit0 + 2*bit1 + 4*bit2), 64 cells at once
+            unsigned long long sumA = left ^ right;
+            unsigned long long carryA = left & right;
+            unsigned long long sumB = upCells ^ downCells;
+            unsigned long long carryB = upCells & downCells;
+            unsigned long long bit0 = sumA ^ sumB;
+            unsigned long long carry = sumA & sumB;
+            unsigned long long bit1 = carryA ^ carryB ^ carry;
+            unsigned long long bit2 = (carryA & carryB) | ((carryA ^ carryB) & carry);
+
+            counts->walkable += PopCount64(cells);
+            counts->deadEnds += PopCount64(cells & bit0 & ~bit1 & ~bit2);
+            counts->junctions += PopCount64(cells & ((bit0 & bit1) | bit2));
+            counts->corridors += PopCount64(cells & ~left & right) + PopCount64(cells & ~upCells & downCells);
+            counts->corridorCells += PopCount64(cells & (left | right)) + PopCount64(cells & (upCells | downCells));
+
+            // Vertical runs: first row kept by column until run ends, runs continued from
+            // band above (started at band first row) are joined later with that band runs
+            unsigned long long starts = cells & ~upCells;
+            if (y == startRow) starts = cells;
+
+            for (; starts != 0; starts &= (starts - 1)) columnStarts[w*64 + CountTrailingZeros64(starts)] = y;
+
+            for (unsigned long long ends = cells & ~downCells; ends != 0; ends &= (ends - 1))
+            {
+                int x = w*64 + CountTrailingZeros64(ends);
+                int length = y - columnStarts[x] + 1;
+
+                if ((columnStarts[x] == startRow) && (aboveBand != NULL) && ((aboveBand[w] >> (x & 63)) & 1)) topRuns[x] = length;
+                else if (length > counts->corridorMaxLength) counts->corridorMaxLength = length;
+            }
+
+            // Vertical runs continued in band below
+            if (y == (endRow - 1))
+            {
+                for (unsigned long long continued = cells & downCells; continued != 0; continued &= (continued - 1))
+                {
+                    int x = w*64 + CountTrailingZeros64(continued);
+                    int length = y - columnStarts[x] + 1;
+
+                    if ((columnStarts[x] == startRow) && (aboveBand != NULL) && ((aboveBand[w] >> (x & 63)) & 1)) topRuns[x] = VERTICAL_RUN_THROUGH;
+                    bottomRuns[x] = length;
+                }
+            }
+        }
+
+        // Horizontal runs: ids given in rows order, merged with overlapping runs of previous band row
+        int currentCount = GetRowRuns(row, wordsPerRow, currentRuns);
+
+        for (int r = 0; r < currentCount; r++)
+        {
+            int length = currentRuns[2*r + 1] - currentRuns[2*r] + 1;
+
+            bands->parents[runId + r] = runId + r;
+            bands->sizes[runId + r] = length;
+
+            if (length > counts->corridorMaxLength) counts->corridorMaxLength = length;
+        }
+
+        if (y > startRow) MergeRowRuns(bands, previousRuns, previousCount, runId - previousCount, currentRuns, currentCount, runId, &counts->unions);
+
+        runId += currentCount;
+
+        int *swap = previousRuns;
+        previousRuns = currentRuns;
+        currentRuns = swap;
+        previousCount = currentCount;
+    }
+
+    free(rowRuns);
+    free(columnStarts);
+}
+
+// Get horizontal runs of walkable cells of a bitmask row, as (first, last) cell pairs, returns runs count
+// NOTE: Runs starts and ends are found in increasing order, so i-th start matches i-th end
+static int GetRowRuns(const unsigned long long *row, int wordsPerRow, int *runs)
+{
+    int startCount = 0;
+    int endCount = 0;
+
+    for (int w = 0; w < wordsPerRow; w++)
+    {
+        unsigned long long cells = row[w];
+
+        if (cells == 0) continue;
+
+        unsigned long long left = (cells << 1) | ((w > 0)? (row[w - 1] >> 63) : 0);
+        unsigned long long right = (cells >> 1) | ((w < (wordsPerRow - 1))? (row[w + 1] << 63) : 0);
+
+        for (unsigned long long starts = cells & ~left; starts != 0; starts &= (starts - 1)) runs[2*(startCount++)] = w*64 + CountTrailingZeros64(starts);
+        for (unsigned long long ends = cells & ~right; ends != 0; ends &= (ends - 1)) runs[2*(endCount++) + 1] = w*64 + CountTrailingZeros64(ends);
+    }
+
+    return startCount;
+}
+
+// Merge overlapping runs of consecutive rows (sorted by column) into same connected region
+static void MergeRowRuns(MazeStatsBands *bands, const int *previousRuns, int previousCount, int previousFirst,
+                         const int *currentRuns, int currentCount, int currentFirst, int *unions)
+{
+    int *parents = bands->parents;
+    int *sizes = bands->sizes;
+
+    for (int p = 0, c = 0; (p < previousCount) && (c < currentCount); )
+    {
+        if ((previousRuns[2*p] <= currentRuns[2*c + 1]) && (currentRuns[2*c] <= previousRuns[2*p + 1]))
+        {
+            int rootA = FindRunRoot(parents, previousFirst + p);
+            int rootB = FindRunRoot(parents, currentFirst + c);
+
+            if (rootA != rootB)
+            {
+                // Union by size, smaller region attached to bigger one
+                int bigger = (sizes[rootA] >= sizes[rootB])? rootA : rootB;
+                int smaller = (bigger == rootA)? rootB : rootA;
+
+                parents[smaller] = bigger;
+                sizes[bigger] += sizes[smaller];
+                (*unions)++;
+            }
+        }
+
+        // Run ending first can not overlap any further run
+        if (previousRuns[2*p + 1] < currentRuns[2*c + 1]) p++;
+        else c++;
+    }
+}
+
+// Find connected region root run, halving path to root on the way
+static int FindRunRoot(int *parents, int run)
+{
+    while (parents[run] != run)
+    {
+        parents[run] = parents[parents[run]];
+        run = parents[run];
+    }
+
+    return run;
+}
@@ -0,0 +1,60 @@
+/*******************************************************************************************
+*
+*   maze_stats - Maze analytics: cell counts, dead ends, corridors and connected regions
+*
+*   Grid cells are packed into walkable cells row bitmasks (one bit per cell, 64 cells per
+*   word), all per-cell statistics are computed with bitwise operations on whole words
+*   (neighbors masks by shifting words, neighbors count by bit-sliced adders, counts by
+*   popcount) in parallel bands of MAZE_STATS_BAND_ROWS rows, so 64 cells are analyzed at once
+*
+*   Connected regions are found with union-find over horizontal runs of walkable cells
+*   (not cells), merging runs overlapping between consecutive rows
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#ifndef MAZE_STATS_H
+#define MAZE_STATS_H
+
+#include "maze_grid.h"      // Required for: MazeGrid
+
+#define MAZE_STATS_BAND_ROWS    256     // Maze rows analyzed by every parallel job
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Maze statistics
+// NOTE: Walkable cells are all non-wall cells (floor, item, exit), cells are 4-connected
+typedef struct MazeStats {
+    int width;                  // Maze width in cells
+    int height;                 // Maze height in cells
+    int wallCount;              // Wall cells
+    int walkableCount;          // Walkable cells
+    int itemCount;              // Item cells
+    float wallRatio;            // Wall cells per walkable cell
+    float itemDensity;          // Item cells per walkable cell
+    int deadEndCount;           // Walkable cells with a single walkable neighbor
+    int junctionCount;          // Walkable cells with 3 or more walkable neighbors
+    int corridorCount;          // Straight corridors: horizontal and vertical runs of 2 or more walkable cells
+    float corridorMeanLength;   // Straight corridors average length, in cells
+    int corridorMaxLength;      // Straight corridors max length, in cells
+    int componentCount;         // Connected regions of walkable cells
+    int largestComponent;       // Walkable cells in largest connected region
+} MazeStats;
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+MazeStats GetMazeStats(MazeGrid grid, int threadCount);     // Get maze statistics, if threadCount <= 0, all hardware threads are used
+void DrawMazeStats(MazeStats stats, int posX, int posY);    // Draw maze statistics overlay (stats table)
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // MAZE_STATS_H
@@ -0,0 +1,220 @@
+/*******************************************************************************************
+*
+*   maze_visibility - Maze cells visibility (field of view) and explored cells, as bitsets
+*
+*   Recursive shadowcasting: view is divided in 8 octants, every octant is scanned row by
+*   row moving away from origin, wall cells start shadows (slopes ranges) that are skipped
+*   in next rows, so cells hidden behind walls are never visited
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "maze_visibility.h"
+
+#include <stdlib.h>     // Required for: calloc(), free()
+#include <string.h>     // Required for: memset()
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Octant being scanned, transforms octant coordinates (row, column) to grid coordinates
+typedef struct ShadowOctant {
+    MazeVisibility *visibility;
+    MazeGrid grid;
+    int xx, xy, yx, yy;             // Octant transform
+} ShadowOctant;
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Declaration
+//----------------------------------------------------------------------------------
+static void SetCellVisible(MazeVisibility *visibility, int x, int y);                       // Set cell visible and explored, cells out of grid are ignored
+static void ClearVisibleArea(MazeVisibility *visibility, Point origin);                     // Clear visible cells bits in view radius area around origin
+static void CastShadows(const ShadowOctant *octant, int row, float startSlope, float endSlope);    // Scan octant rows from row, between slopes
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Load visibility, no cells visible or explored
+MazeVisibility LoadMazeVisibility(int width, int height, int radius)
+{
+    MazeVisibility visibility = { 0 };
+
+    if ((width <= 0) || (height <= 0)) return visibility;
+
+    visibility.width = width;
+    visibility.height = height;
+    visibility.radius = radius;
+    visibility.wordsPerRow = (width + 63)/64;
+    visibility.origin = (Point){ -1, -1 };
+    visibility.visible = (unsigned long long *)calloc((size_t)visibility.wordsPerRow*height, sizeof(unsigned long long));
+    visibility.explored = (unsigned long long *)calloc((size_t)visibility.wordsPerRow*height, sizeof(unsigned long long));
+
+    return visibility;
+}
+
+// Load visibility, no cells visible or explored, with all memory taken from arena
+// NOTE: Visibility data stays in arena (freed on arena reset), UnloadMazeVisibility() must not be called
+MazeVisibility LoadMazeVisibilityArena(MazeArena *arena, int width, int height, int radius)
+{
+    MazeVisibility visibility = { 0 };
+
+    if ((width <= 0) || (height <= 0)) return visibility;
+
+    int wordsPerRow = (width + 63)/64;
+    size_t bitsetSize = (size_t)wordsPerRow*height*sizeof(unsigned long long);
+
+    visibility.visible = (unsigned long long *)AllocMazeArena(arena, bitsetSize);
+    visibility.explored = (unsigned long long *)AllocMazeArena(arena, bitsetSize);
+
+    if ((visibility.visible == NULL) || (visibility.explored == NULL)) return (MazeVisibility){ 0 };
+
+    visibility.width = width;
+    visibility.height = height;
+    visibility.radius = radius;
+    visibility.wordsPerRow = wordsPerRow;
+
+    ClearMazeVisibility(&visibility);
+
+    return visibility;
+}
+
+// Unload visibility from memory (RAM)
+void UnloadMazeVisibility(MazeVisibility visibility)
+{
+    free(visibility.visible);
+    free(visibility.explored);
+}
+
+// Clear visible and explored cells, keeping memory
+void ClearMazeVisibility(MazeVisibility *visibility)
+{
+    if (visibility->visible == NULL) return;
+
+    size_t bitsetSize = (size_t)visibility->wordsPerRow*visibility->height*sizeof(unsigned long long);
+
+    memset(visibility->visible, 0, bitsetSize);
+    memset(visibility->explored, 0, bitsetSize);
+
+    visibility->origin = (Point){ -1, -1 };
+}
+
+// Compute visible cells from origin, only if origin changed, returns true if computed
+// NOTE: Wall cells are visible (lit faces), cells out of grid are considered walls
+bool UpdateMazeVisibility(MazeVisibility *visibility, MazeGrid grid, Point origin)
+{
+    if ((visibility->visible == NULL) || (visibility->width != grid.width) || (visibility->height != grid.height)) return false;
+    if ((origin.x == visibility->origin.x) && (origin.y == visibility->origin.y)) return false;
+
+    // Previous visible cells are all in view radius area around previous origin
+    if (visibility->origin.x >= 0) ClearVisibleArea(visibility, visibility->origin);
+
+    visibility->origin = origin;
+
+    if (((unsigned int)origin.x >= (unsigned int)grid.width) || ((unsigned int)origin.y >= (unsigned int)grid.height)) return true;
+
+    SetCellVisible(visibility, origin.x, origin.y);
+
+    // Octants transforms, from octant (column, row) to grid (x, y) offsets
+    static const int transforms[8][4] = {
+        { 1, 0, 0, 1 }, { 0, 1, 1, 0 }, { 0, -1, 1, 0 }, { -1, 0, 0, 1 },
+        { -1, 0, 0, -1 }, { 0, -1, -1, 0 }, { 0, 1, -1, 0 }, { 1, 0, 0, -1 },
+    };
+
+    for (int i = 0; i < 8; i++)
+    {
+        ShadowOctant octant = { visibility, grid, transforms[i][0], transforms[i][1], transforms[i][2], transforms[i][3] };
+
+        CastShadows(&octant, 1, 1.0f, 0.0f);
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+// Set cell visible and explored, cells out of grid are ignored
+static void SetCellVisible(MazeVisibility *visibility, int x, int y)
+{
+    if (((unsigned int)x >= (unsigned int)visibility->width) || ((unsigned int)y >= (unsigned int)visibility->height)) return;
+
+    int word = y*visibility->wordsPerRow + (x >> 6);
+    unsigned long long bit = 1ULL << (x & 63);
+
+    visibility->visible[word] |= bit;
+    visibility->explored[word] |= bit;
+}
+
+// Clear visible cells bits in view radius area around origin
+// NOTE: Whole words are cleared, no cell out of view radius area can be visible
+static void ClearVisibleArea(MazeVisibility *visibility, Point origin)
+{
+    int radius = visibility->radius;
+    int startY = (origin.y - radius < 0)? 0 : origin.y - radius;
+    int endY = (origin.y + radius >= visibility->height)? visibility->height - 1 : origin.y + radius;
+    int startWord = (origin.x - radius < 0)? 0 : (origin.x - radius) >> 6;
+    int endWord = (origin.x + radius >= visibility->width)? visibility->wordsPerRow - 1 : (origin.x + radius) >> 6;
+
+    for (int y = startY; y <= endY; y++)
+    {
+        unsigned long long *row = visibility->visible + y*visibility->wordsPerRow;
+
+        for (int w = startWord; w <= endWord; w++) row[w] = 0;
+    }
+}
+
+// Scan octant rows from row, between slopes (1.0f: diagonal, 0.0f: octant axis)
+// NOTE: Every wall found starts a shadow, rest of the row is scanned with a narrowed slope range
+// and cells after the wall are scanned recursively, limited by view radius
+static void CastShadows(const ShadowOctant *octant, int row, float startSlope, float endSlope)
+{
+    if (startSlope < endSlope) return;
+
+    MazeVisibility *visibility = octant->visibility;
+    Point origin = visibility->origin;
+    int radius = visibility->radius;
+    float nextStartSlope = startSlope;
+
+    for (int j = row; j <= radius; j++)
+    {
+        bool blocked = false;
+
+        for (int dx = -j, dy = -j; dx <= 0; dx++)
+        {
+            int x = origin.x + dx*octant->xx + dy*octant->xy;
+            int y = origin.y + dx*octant->yx + dy*octant->yy;
+
+            // Cell slopes range, from its left to its right corner
+            float leftSlope = (dx - 0.5f)/(dy + 0.5f);
+            float rightSlope = (dx + 0.5f)/(dy - 0.5f);
+
+            if (startSlope < rightSlope) continue;
+            else if (endSlope > leftSlope) break;
+
+            if ((dx*dx + dy*dy) <= (radius*radius)) SetCellVisible(visibility, x, y);
+
+            bool wall = (GetMazeCell(octant->grid, x, y) == MAZE_CELL_WALL);
+
+            if (blocked)
+            {
+                // Scanning shadow cells, shadow ends on first non-wall cell
+                if (wall) nextStartSlope = rightSlope;
+                else
+                {
+                    blocked = false;
+                    startSlope = nextStartSlope;
+                }
+            }
+            else if (wall && (j < radius))
+            {
+                // Shadow begins, cells before it are scanned in next rows
+                blocked = true;
+                CastShadows(octant, j + 1, startSlope, leftSlope);
+                nextStartSlope = rightSlope;
+            }
+        }
+
+        if (blocked) break;
+    }
+}
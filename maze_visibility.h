@@ -0,0 +1,68 @@
+/*******************************************************************************************
+*
+*   maze_visibility - Maze cells visibility (field of view) and explored cells, as bitsets
+*
+*   Cells visible from an origin cell are computed with recursive shadowcasting over wall
+*   cells, limited to a view radius, only when origin changes: only cells around previous
+*   and new origin are visited, so cost depends on view radius, never on maze size
+*
+*   Visible and explored cells are stored as bitsets (one bit per cell, 64 cells per word,
+*   rows padded to full words), so renderers can skip whole words of hidden cells at once
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#ifndef MAZE_VISIBILITY_H
+#define MAZE_VISIBILITY_H
+
+#include "maze_grid.h"      // Required for: MazeGrid, Point, MazeArena
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Maze visibility, cells visible from origin and cells explored (visible at any time since cleared)
+// NOTE: Origin (-1, -1) means no visibility computed, next update always computes it
+typedef struct MazeVisibility {
+    int width;                      // Visibility width, same as grid
+    int height;                     // Visibility height, same as grid
+    int radius;                     // View radius, in cells
+    int wordsPerRow;                // Bitset words per grid row
+    Point origin;                   // Cell visibility was computed from
+    unsigned long long *visible;    // Cells visible from origin, one bit per cell, row-major
+    unsigned long long *explored;   // Cells explored, one bit per cell, row-major
+} MazeVisibility;
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+MazeVisibility LoadMazeVisibility(int width, int height, int radius);                      // Load visibility, no cells visible or explored
+MazeVisibility LoadMazeVisibilityArena(MazeArena *arena, int width, int height, int radius);   // Load visibility, with all memory taken from arena
+void UnloadMazeVisibility(MazeVisibility visibility);                                       // Unload visibility from memory (RAM)
+void ClearMazeVisibility(MazeVisibility *visibility);                                       // Clear visible and explored cells, keeping memory
+
+bool UpdateMazeVisibility(MazeVisibility *visibility, MazeGrid grid, Point origin);         // Compute visible cells from origin, only if origin changed, returns true if computed
+
+// Check if cell is visible from origin, cells out of grid are never visible
+static inline bool IsMazeCellVisible(MazeVisibility visibility, int x, int y)
+{
+    return (((unsigned int)x < (unsigned int)visibility.width) && ((unsigned int)y < (unsigned int)visibility.height))?
+        ((visibility.visible[y*visibility.wordsPerRow + (x >> 6)] >> (x & 63)) & 1) : false;
+}
+
+// Check if cell was explored (visible at any time since visibility was cleared)
+static inline bool IsMazeCellExplored(MazeVisibility visibility, int x, int y)
+{
+    return (((unsigned int)x < (unsigned int)visibility.width) && ((unsigned int)y < (unsigned int)visibility.height))?
+        ((visibility.explored[y*visibility.wordsPerRow + (x >> 6)] >> (x & 63)) & 1) : false;
+}
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // MAZE_VISIBILITY_H
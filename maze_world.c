@@ -0,0 +1,246 @@
+/*******************************************************************************************
+*
+*   maze_world - Chunked streaming maze, for unbounded worlds
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "maze_world.h"
+
+#include <stdlib.h>     // Required for: malloc(), calloc(), free()
+#include <string.h>     // Required for: memset(), memcpy()
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Declaration
+//----------------------------------------------------------------------------------
+static MazeChunk *GetMazeWorldChunk(MazeWorld *world, Point coord);                 // Get chunk from pool, generating it if required
+static void GenMazeChunkCells(MazeWorld *world, Point coord, MazeGrid grid);        // Generate chunk cells, only from seed and coord
+static void GenMazeChunkDoors(MazeRandom *rng, unsigned char *seam, int stride, int spacing);  // Open random doors in a seam
+static int FloorDiv(int value, int divisor);                                        // Integer division rounding to negative infinity
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Load maze world, all memory allocated once, view centered on chunk (0, 0)
+// NOTE: maxChunks is clamped to viewChunks*viewChunks at least, view chunks are never evicted
+MazeWorld LoadMazeWorld(unsigned int seed, int spacing, float pointChance, int viewChunks, int maxChunks)
+{
+    MazeWorld world = { 0 };
+
+    // Seams and doors require corridors between points rows/columns
+    if ((spacing < 2) || ((MAZE_CHUNK_SIZE%spacing) != 0) || (viewChunks < 1)) return world;
+
+    if ((viewChunks%2) == 0) viewChunks++;
+    if (maxChunks < viewChunks*viewChunks) maxChunks = viewChunks*viewChunks;
+
+    int pointsPerSide = MAZE_CHUNK_SIZE/spacing - 1;
+
+    world.seed = seed;
+    world.spacing = spacing;
+    world.pointThreshold = (int)(pointChance*100);
+    world.maxChunks = maxChunks;
+    world.chunks = (MazeChunk *)calloc(maxChunks, sizeof(MazeChunk));
+    world.points = (int *)malloc((pointsPerSide*pointsPerSide + 1)*sizeof(int));
+    world.viewChunks = viewChunks;
+    world.view = LoadMazeGrid(viewChunks*MAZE_CHUNK_SIZE, viewChunks*MAZE_CHUNK_SIZE);
+
+    for (int i = 0; i < maxChunks; i++) world.chunks[i].grid = LoadMazeGrid(MAZE_CHUNK_SIZE, MAZE_CHUNK_SIZE);
+
+    // Force first view update
+    world.viewChunk = (Point){ 1, 0 };
+    UpdateMazeWorldView(&world, (Point){ 0, 0 });
+
+    return world;
+}
+
+// Unload maze world from memory (RAM)
+void UnloadMazeWorld(MazeWorld world)
+{
+    for (int i = 0; i < world.maxChunks; i++) UnloadMazeGrid(world.chunks[i].grid);
+
+    free(world.chunks);
+    free(world.points);
+    UnloadMazeGrid(world.view);
+}
+
+// Center view on chunk containing world cell, returns true if view moved
+// NOTE: View includes the chunks around center chunk, so they are generated before getting visible
+bool UpdateMazeWorldView(MazeWorld *world, Point cell)
+{
+    if (world->chunks == NULL) return false;
+
+    Point center = GetMazeWorldChunkCoord(cell);
+
+    if ((center.x == world->viewChunk.x) && (center.y == world->viewChunk.y)) return false;
+
+    int radius = world->viewChunks/2;
+
+    world->useCounter++;
+    world->viewChunk = center;
+    world->viewOrigin = (Point){ (center.x - radius)*MAZE_CHUNK_SIZE, (center.y - radius)*MAZE_CHUNK_SIZE };
+
+    // Copy chunks rows into view grid
+    for (int cy = 0; cy < world->viewChunks; cy++)
+    {
+        for (int cx = 0; cx < world->viewChunks; cx++)
+        {
+            MazeChunk *chunk = GetMazeWorldChunk(world, (Point){ center.x - radius + cx, center.y - radius + cy });
+            unsigned char *dest = world->view.cells + (size_t)cy*MAZE_CHUNK_SIZE*world->view.width + cx*MAZE_CHUNK_SIZE;
+
+            for (int y = 0; y < MAZE_CHUNK_SIZE; y++)
+            {
+                memcpy(dest + (size_t)y*world->view.width, chunk->grid.cells + y*MAZE_CHUNK_SIZE, MAZE_CHUNK_SIZE);
+            }
+        }
+    }
+
+    return true;
+}
+
+// Get world cell kind, generating its chunk if required
+MazeCell GetMazeWorldCell(MazeWorld *world, int x, int y)
+{
+    if (world->chunks == NULL) return MAZE_CELL_WALL;
+
+    Point coord = GetMazeWorldChunkCoord((Point){ x, y });
+    MazeChunk *chunk = GetMazeWorldChunk(world, coord);
+
+    return GetMazeCell(chunk->grid, x - coord.x*MAZE_CHUNK_SIZE, y - coord.y*MAZE_CHUNK_SIZE);
+}
+
+// Get chunk coordinates containing a world cell
+Point GetMazeWorldChunkCoord(Point cell)
+{
+    return (Point){ FloorDiv(cell.x, MAZE_CHUNK_SIZE), FloorDiv(cell.y, MAZE_CHUNK_SIZE) };
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+// Get chunk from pool, generating it if required
+// NOTE: If pool is full, least recently used chunk is evicted, chunks used
+// by current view have the latest stamp so they are never evicted
+static MazeChunk *GetMazeWorldChunk(MazeWorld *world, Point coord)
+{
+    MazeChunk *chunk = NULL;
+
+    for (int i = 0; i < world->chunkCount; i++)
+    {
+        if ((world->chunks[i].coord.x == coord.x) && (world->chunks[i].coord.y == coord.y))
+        {
+            chunk = &world->chunks[i];
+            break;
+        }
+    }
+
+    if (chunk == NULL)
+    {
+        if (world->chunkCount < world->maxChunks) chunk = &world->chunks[world->chunkCount++];
+        else
+        {
+            chunk = &world->chunks[0];
+
+            for (int i = 1; i < world->chunkCount; i++)
+            {
+                if (world->chunks[i].lastUsed < chunk->lastUsed) chunk = &world->chunks[i];
+            }
+        }
+
+        chunk->coord = coord;
+        GenMazeChunkCells(world, coord, chunk->grid);
+    }
+
+    chunk->lastUsed = world->useCounter;
+
+    return chunk;
+}
+
+// Generate chunk cells, only from seed and coord, using grid-based algorithm
+// NOTE: Points are placed at chunk local multiples of spacing, top row and left column
+// are the chunk seams, lines leaving the chunk end on next chunk seam
+static void GenMazeChunkCells(MazeWorld *world, Point coord, MazeGrid grid)
+{
+    int size = MAZE_CHUNK_SIZE;
+    int spacing = world->spacing;
+    unsigned long long stream = ((unsigned long long)(unsigned int)coord.y << 32) | (unsigned int)coord.x;
+    MazeRandom rng = InitMazeRandom(world->seed, stream);
+
+    // STEP 1: All cells walkable, but seams
+    memset(grid.cells, MAZE_CELL_FLOOR, (size_t)size*size);
+    memset(grid.cells, MAZE_CELL_WALL, size);
+    for (int y = 1; y < size; y++) grid.cells[y*size] = MAZE_CELL_WALL;
+
+    // STEP 2: Open doors in top and left seams
+    GenMazeChunkDoors(&rng, grid.cells, 1, spacing);
+    GenMazeChunkDoors(&rng, grid.cells, size, spacing);
+
+    // STEP 3: Set some random points, at specific row-column distances
+    int *mazePoints = world->points;
+    int mazePointCounter = 0;
+
+    for (int y = spacing; y < size; y += spacing)
+    {
+        for (int x = spacing; x < size; x += spacing)
+        {
+            if (GetMazeRandomValue(&rng, 0, 100) <= world->pointThreshold)
+            {
+                mazePoints[mazePointCounter] = y*size + x;
+                mazePointCounter++;
+            }
+        }
+    }
+
+    for (int i = 0; i < mazePointCounter; i++) grid.cells[mazePoints[i]] = MAZE_CELL_WALL;
+
+    // STEP 4: Draw lines from every point (shuffled) in a random direction,
+    // until a wall is found or line leaves the chunk
+    for (int i = mazePointCounter - 1; i > 0; i--)
+    {
+        int j = GetMazeRandomValue(&rng, 0, i);
+        int temp = mazePoints[i];
+        mazePoints[i] = mazePoints[j];
+        mazePoints[j] = temp;
+    }
+
+    static const Point directions[4] = { { 1, 0 }, { -1, 0 }, { 0, 1 }, { 0, -1 } };
+
+    for (int i = 0; i < mazePointCounter; i++)
+    {
+        Point dir = directions[GetMazeRandomValue(&rng, 0, 3)];
+        int x = mazePoints[i]%size + dir.x;
+        int y = mazePoints[i]/size + dir.y;
+
+        while ((x < size) && (y < size) && (grid.cells[y*size + x] == MAZE_CELL_FLOOR))
+        {
+            grid.cells[y*size + x] = MAZE_CELL_WALL;
+            x += dir.x;
+            y += dir.y;
+        }
+    }
+}
+
+// Open random doors in a seam, one per segment between points positions at most
+// NOTE: Doors are never placed on points rows/columns, at least one door is always opened
+static void GenMazeChunkDoors(MazeRandom *rng, unsigned char *seam, int stride, int spacing)
+{
+    int segments = MAZE_CHUNK_SIZE/spacing;
+    int forcedSegment = GetMazeRandomValue(rng, 0, segments - 1);
+
+    for (int i = 0; i < segments; i++)
+    {
+        int door = i*spacing + GetMazeRandomValue(rng, 1, spacing - 1);
+
+        if ((i == forcedSegment) || (GetMazeRandomValue(rng, 0, 99) < MAZE_CHUNK_DOOR_CHANCE)) seam[door*stride] = MAZE_CELL_FLOOR;
+    }
+}
+
+// Integer division rounding to negative infinity, so negative cells map to negative chunks
+static int FloorDiv(int value, int divisor)
+{
+    int result = value/divisor;
+
+    if (((value%divisor) != 0) && (value < 0)) result--;
+
+    return result;
+}
@@ -0,0 +1,76 @@
+/*******************************************************************************************
+*
+*   maze_world - Chunked streaming maze, for unbounded worlds
+*
+*   World is split in MAZE_CHUNK_SIZE square chunks, every chunk generated on demand
+*   only from (seed, chunk coordinates), so it can be evicted and generated again
+*   with the same cells. Chunks are kept in a fixed pool (memory budget), least
+*   recently used chunks are evicted first
+*
+*   Every chunk owns its top row and left column as walls (seams), with random doors
+*   placed between points positions; grid-based algorithm walls only lie on points rows
+*   and columns, so cells at both sides of a door are always walkable and chunks
+*   connect cleanly, without reading any neighbor chunk
+*
+*   Cells around a center chunk are copied into a view grid, so any MazeGrid function
+*   (collision, drawing) can be used with the world, view only changes on chunk crossing
+*
+*   Copyright (c) 2024-2025 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#ifndef MAZE_WORLD_H
+#define MAZE_WORLD_H
+
+#include "maze_grid.h"      // Required for: MazeGrid, Point, MazeRandom
+
+#define MAZE_CHUNK_SIZE         64      // Chunk size in cells, points spacing must divide it
+#define MAZE_CHUNK_DOOR_CHANCE  25      // Chance of a door for every seam segment (percentage)
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// World chunk
+typedef struct MazeChunk {
+    Point coord;                // Chunk coordinates, in chunks
+    MazeGrid grid;              // Chunk cells, MAZE_CHUNK_SIZE*MAZE_CHUNK_SIZE
+    unsigned int lastUsed;      // Last use stamp, for eviction
+} MazeChunk;
+
+// Chunked maze world
+typedef struct MazeWorld {
+    unsigned int seed;          // World seed
+    int spacing;                // Points spacing, rows and columns
+    int pointThreshold;         // Point chance, scaled to [0..100]
+    int maxChunks;              // Chunks pool size (memory budget)
+    int chunkCount;             // Chunks generated in pool
+    MazeChunk *chunks;          // Chunks pool
+    int *points;                // Chunk generation points buffer
+    unsigned int useCounter;    // Use stamp, increased on every view update
+    int viewChunks;             // View size in chunks (odd, centered on view chunk)
+    Point viewChunk;            // View center chunk
+    Point viewOrigin;           // World cell at view grid top-left
+    MazeGrid view;              // Cells around view center, copied from chunks
+} MazeWorld;
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+// Load maze world, all memory allocated once, view centered on chunk (0, 0)
+// NOTE: maxChunks is clamped to viewChunks*viewChunks at least, view chunks are never evicted
+MazeWorld LoadMazeWorld(unsigned int seed, int spacing, float pointChance, int viewChunks, int maxChunks);
+void UnloadMazeWorld(MazeWorld world);                                      // Unload maze world from memory (RAM)
+
+bool UpdateMazeWorldView(MazeWorld *world, Point cell);                     // Center view on chunk containing world cell, returns true if view moved
+MazeCell GetMazeWorldCell(MazeWorld *world, int x, int y);                  // Get world cell kind, generating its chunk if required
+Point GetMazeWorldChunkCoord(Point cell);                                   // Get chunk coordinates containing a world cell
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // MAZE_WORLD_H